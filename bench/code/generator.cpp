@@ -0,0 +1,243 @@
+
+/*
+  Generates a synthetic project for cbuild's scaling benchmarks. Arguments are passed as key=value pairs:
+
+    out=<PATH>       Folder where the project is generated, must not exist. Required.
+    targets=<NUM>    Number of static libraries, each library links with up to 'deps' previous ones. Default 16.
+    files=<NUM>      Number of source files per library. Default 32.
+    headers=<NUM>    Number of shared headers per layer. Default 16.
+    depth=<NUM>      Number of header layers, headers of each layer include headers from the next one. Default 4.
+    fan_in=<NUM>     Number of first layer headers included by each source file. Default 4.
+    fan_out=<NUM>    Number of next layer headers included by each header. Default 2.
+    deps=<NUM>       Number of upstream libraries each library links with. Default 2.
+
+  The project also gets an executable 'app' that links with the last library. Generated build.cpp uses the 'stub'
+  argument, if it's passed to cbuild, as the path to all tools of the toolchain, which isolates cbuild's own overhead
+  from the compiler's.
+ */
+
+#include <direct.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct Parameters {
+  const char *out = nullptr;
+
+  int targets = 16;
+  int files   = 32;
+  int headers = 16;
+  int depth   = 4;
+  int fan_in  = 4;
+  int fan_out = 2;
+  int deps    = 2;
+};
+
+static bool parse_parameters (int argc, char **argv, Parameters &params) {
+  struct { const char *key; int *slot; } numbers [] {
+    { "targets", &params.targets },
+    { "files",   &params.files   },
+    { "headers", &params.headers },
+    { "depth",   &params.depth   },
+    { "fan_in",  &params.fan_in  },
+    { "fan_out", &params.fan_out },
+    { "deps",    &params.deps    },
+  };
+
+  for (int idx = 1; idx < argc; idx++) {
+    auto arg       = argv[idx];
+    auto separator = strchr(arg, '=');
+    if (!separator) {
+      fprintf(stderr, "Unexpected argument '%s', expected key=value\n", arg);
+      return false;
+    }
+
+    auto key_length = static_cast<size_t>(separator - arg);
+    auto value      = separator + 1;
+
+    if (key_length == 3 && !strncmp(arg, "out", 3)) {
+      params.out = value;
+      continue;
+    }
+
+    bool found = false;
+    for (auto &[key, slot]: numbers) {
+      if (strlen(key) == key_length && !strncmp(arg, key, key_length)) {
+        *slot = atoi(value);
+        found = true;
+        break;
+      }
+    }
+
+    if (!found) {
+      fprintf(stderr, "Unknown parameter '%.*s'\n", static_cast<int>(key_length), arg);
+      return false;
+    }
+  }
+
+  if (!params.out) {
+    fprintf(stderr, "Output folder is not set, use out=<PATH>\n");
+    return false;
+  }
+
+  if (params.targets < 1 || params.files < 1 || params.headers < 1 || params.depth < 1) {
+    fprintf(stderr, "Values of 'targets', 'files', 'headers' and 'depth' must be positive\n");
+    return false;
+  }
+
+  if (params.fan_in  > params.headers) params.fan_in  = params.headers;
+  if (params.fan_out > params.headers) params.fan_out = params.headers;
+  if (params.fan_in  < 0) params.fan_in  = 0;
+  if (params.fan_out < 0) params.fan_out = 0;
+  if (params.deps    < 0) params.deps    = 0;
+
+  return true;
+}
+
+static bool make_folder (const char *path) {
+  if (_mkdir(path) == 0) return true;
+
+  fprintf(stderr, "Couldn't create folder %s\n", path);
+  return false;
+}
+
+static FILE * create_file (const char *path) {
+  auto file = fopen(path, "wb");
+  if (!file) fprintf(stderr, "Couldn't create file %s\n", path);
+
+  return file;
+}
+
+/*
+  Headers are spread evenly over the next layer, thus every header of the next layer is included by someone.
+ */
+static int pick_header (int owner, int slot, int headers) {
+  return (owner * 7 + slot * 13) % headers;
+}
+
+static bool generate_headers (const Parameters &params) {
+  char path[1024];
+
+  for (int layer = 0; layer < params.depth; layer++) {
+    for (int idx = 0; idx < params.headers; idx++) {
+      snprintf(path, sizeof(path), "%s/code/shared/h%d_%d.hpp", params.out, layer, idx);
+
+      auto file = create_file(path);
+      if (!file) return false;
+
+      fprintf(file, "#pragma once\n\n");
+
+      if (layer + 1 < params.depth) {
+        for (int slot = 0; slot < params.fan_out; slot++)
+          fprintf(file, "#include \"h%d_%d.hpp\"\n", layer + 1, pick_header(idx, slot, params.headers));
+        fprintf(file, "\n");
+      }
+
+      fprintf(file, "inline int h%d_%d_value () { return %d; }\n", layer, idx, layer * params.headers + idx);
+
+      fclose(file);
+    }
+  }
+
+  return true;
+}
+
+static bool generate_sources (const Parameters &params) {
+  char path[1024];
+
+  for (int target = 0; target < params.targets; target++) {
+    snprintf(path, sizeof(path), "%s/code/lib%d", params.out, target);
+    if (!make_folder(path)) return false;
+
+    for (int idx = 0; idx < params.files; idx++) {
+      snprintf(path, sizeof(path), "%s/code/lib%d/lib%d_f%d.cpp", params.out, target, target, idx);
+
+      auto file = create_file(path);
+      if (!file) return false;
+
+      for (int slot = 0; slot < params.fan_in; slot++)
+        fprintf(file, "#include \"h0_%d.hpp\"\n", pick_header(target * params.files + idx, slot, params.headers));
+
+      fprintf(file, "\nint lib%d_f%d () { return %d; }\n", target, idx, idx);
+
+      fclose(file);
+    }
+  }
+
+  snprintf(path, sizeof(path), "%s/code/app", params.out);
+  if (!make_folder(path)) return false;
+
+  snprintf(path, sizeof(path), "%s/code/app/main.cpp", params.out);
+
+  auto file = create_file(path);
+  if (!file) return false;
+
+  fprintf(file, "int main () { return 0; }\n");
+  fclose(file);
+
+  return true;
+}
+
+static bool generate_build_file (const Parameters &params) {
+  char path[1024];
+  snprintf(path, sizeof(path), "%s/project/build.cpp", params.out);
+
+  auto file = create_file(path);
+  if (!file) return false;
+
+  fprintf(file,
+          "\n#include \"cbuild.h\"\n"
+          "#include \"cbuild_experimental.h\"\n\n"
+          "#include <stdio.h>\n\n"
+          "extern \"C\" bool setup_project (const Arguments *args, Project *project) {\n"
+          "  auto stub = get_argument_or_default(args, \"stub\", nullptr);\n"
+          "  if (stub) overwrite_toolchain(project, Toolchain_Configuration { Toolchain_Type_LLVM, stub, stub, stub, stub });\n"
+          "  else      set_toolchain(project, Toolchain_Type_LLVM);\n\n"
+          "  add_global_include_search_path(project, \"code/shared\");\n\n"
+          "  Target *libraries[%d];\n"
+          "  char name[32], folder[64];\n\n"
+          "  for (int idx = 0; idx < %d; idx++) {\n"
+          "    snprintf(name,   sizeof(name),   \"lib%%d\", idx);\n"
+          "    snprintf(folder, sizeof(folder), \"code/lib%%d\", idx);\n\n"
+          "    libraries[idx] = add_static_library(project, name);\n"
+          "    add_all_sources_from_directory(libraries[idx], folder, \"cpp\", false);\n\n"
+          "    for (int dep = 1; dep <= %d && dep <= idx; dep++) link_with_target(libraries[idx], libraries[idx - dep]);\n"
+          "  }\n\n"
+          "  auto app = add_executable(project, \"app\");\n"
+          "  add_source_file(app, \"code/app/main.cpp\");\n"
+          "  link_with_target(app, libraries[%d]);\n\n"
+          "  return true;\n"
+          "}\n",
+          params.targets, params.targets, params.deps, params.targets - 1);
+
+  fclose(file);
+
+  return true;
+}
+
+int main (int argc, char **argv) {
+  Parameters params;
+  if (!parse_parameters(argc, argv, params)) return 1;
+
+  char path[1024];
+
+  if (!make_folder(params.out)) return 1;
+
+  snprintf(path, sizeof(path), "%s/project", params.out);
+  if (!make_folder(path)) return 1;
+
+  snprintf(path, sizeof(path), "%s/code", params.out);
+  if (!make_folder(path)) return 1;
+
+  snprintf(path, sizeof(path), "%s/code/shared", params.out);
+  if (!make_folder(path)) return 1;
+
+  if (!generate_headers(params))    return 1;
+  if (!generate_sources(params))    return 1;
+  if (!generate_build_file(params)) return 1;
+
+  printf("Generated %d targets, %d source files and %d headers in %s\n",
+         params.targets + 1, params.targets * params.files + 1, params.headers * params.depth, params.out);
+
+  return 0;
+}
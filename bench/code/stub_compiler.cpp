@@ -0,0 +1,71 @@
+
+/*
+  Stands in for the compiler, the linker and the archiver in scaling benchmarks, so that measurements reflect cbuild's
+  own overhead. It only writes the output files that cbuild expects to find after each step:
+
+    -o <PATH>   Object file, clang style.
+    /Fo<PATH>   Object file, MSVC style.
+    /OUT:<PATH> Linked binary or archive. Shared libraries also get an import library next to the binary.
+
+  Set CBUILD_STUB_DELAY to the number of milliseconds each invocation should take, to model the tool's own cost.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Windows.h>
+
+static bool write_stub_file (const char *path) {
+  auto file = fopen(path, "wb");
+  if (!file) {
+    fprintf(stderr, "stub: couldn't write %s\n", path);
+    return false;
+  }
+
+  fputs("cbuild stub output\n", file);
+  fclose(file);
+
+  return true;
+}
+
+/*
+  Shared library's import library has the same name with the .lib extension, which is what downstream targets link with.
+ */
+static bool write_import_library (const char *binary_path) {
+  char path[MAX_PATH];
+  snprintf(path, sizeof(path), "%s", binary_path);
+
+  auto extension = strrchr(path, '.');
+  if (!extension || static_cast<size_t>(extension - path) + 5 > sizeof(path)) return false;
+
+  strcpy(extension, ".lib");
+
+  return write_stub_file(path);
+}
+
+int main (int argc, char **argv) {
+  if (auto delay = getenv("CBUILD_STUB_DELAY")) Sleep(static_cast<DWORD>(atoi(delay)));
+
+  const char *output = nullptr;
+  bool is_shared     = false;
+
+  for (int idx = 1; idx < argc; idx++) {
+    auto arg = argv[idx];
+
+    if      (!strcmp(arg, "-o") && idx + 1 < argc)              output    = argv[++idx];
+    else if (!strncmp(arg, "/Fo", 3))                           output    = arg + 3;
+    else if (!_strnicmp(arg, "/OUT:", 5))                       output    = arg + 5;
+    else if (!_stricmp(arg, "/dll") || !strcmp(arg, "-shared")) is_shared = true;
+  }
+
+  if (!output || !output[0]) {
+    fprintf(stderr, "stub: no output file in the command line\n");
+    return 1;
+  }
+
+  if (!write_stub_file(output)) return 1;
+  if (is_shared && !write_import_library(output)) return 1;
+
+  return 0;
+}
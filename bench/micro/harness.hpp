@@ -0,0 +1,115 @@
+#pragma once
+
+#include "anyfin/base.hpp"
+#include "anyfin/arena.hpp"
+#include "anyfin/string_builder.hpp"
+#include "anyfin/strings.hpp"
+#include "anyfin/timers.hpp"
+
+#include "code/cbuild.hpp"
+
+#include <intrin.h>
+
+/*
+  Minimal timing harness for micro benchmarks. Each operation is first calibrated to find the number of calls that takes
+  at least a millisecond, which also warms up caches and the branch predictor. After that, the operation is measured in
+  a number of batches, reporting the fastest and the median batch. Median is what should be compared between runs,
+  minimum shows how fast the code could go on a quiet machine.
+ */
+
+constexpr usize benchmark_batches_count = 15;
+constexpr usize benchmark_warmup_count  = 3;
+
+/*
+  Keeps the compiler from optimizing away the benchmarked computation.
+ */
+template <typename T>
+static void do_not_optimize (const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+struct Benchmark_Sample {
+  u64 nanos_per_op;
+  u64 cycles_per_op;
+};
+
+struct Benchmark_Runner {
+  Memory_Arena &arena;
+
+  String filter;
+  u64    frequency = get_timer_frequency();
+};
+
+static void sort_samples (Benchmark_Sample (&samples)[benchmark_batches_count]) {
+  for (usize idx = 1; idx < benchmark_batches_count; idx++) {
+    auto value  = samples[idx];
+    auto cursor = idx;
+
+    while (cursor > 0 && samples[cursor - 1].nanos_per_op > value.nanos_per_op) {
+      samples[cursor] = samples[cursor - 1];
+      cursor -= 1;
+    }
+
+    samples[cursor] = value;
+  }
+}
+
+static String format_cycles_per_byte (Memory_Arena &arena, u64 cycles, u64 bytes) {
+  if (bytes == 0) return "n/a";
+
+  auto hundredths = (cycles * 100) / bytes;
+  auto fraction   = hundredths % 100;
+
+  return concat_string(arena, hundredths / 100, ".", (fraction < 10) ? String("0") : String(), fraction);
+}
+
+/*
+  Operation is invoked with the arena that's reset before each call, bytes_per_op is the size of the input it processes,
+  used to compute cycles per byte, or 0 if that's not applicable.
+ */
+static void run_benchmark (Benchmark_Runner &runner, String name, u64 bytes_per_op, const auto &operation) {
+  if (!is_empty(runner.filter) && !has_substring(name, runner.filter)) return;
+
+  const auto run_batch = [&] (u64 count) {
+    auto start_cycles = __rdtsc();
+    auto start_stamp  = get_timer_value();
+
+    for (u64 idx = 0; idx < count; idx++) {
+      auto local = runner.arena;
+      operation(local);
+    }
+
+    auto end_stamp  = get_timer_value();
+    auto end_cycles = __rdtsc();
+
+    return Benchmark_Sample {
+      .nanos_per_op  = ((end_stamp - start_stamp) * 1'000'000'000) / (runner.frequency * count),
+      .cycles_per_op = (end_cycles - start_cycles) / count,
+    };
+  };
+
+  u64 batch_size = 1;
+  while (true) {
+    auto start = get_timer_value();
+    run_batch(batch_size);
+    auto elapsed = get_timer_value() - start;
+
+    if (elapsed * 1000 >= runner.frequency) break;
+    batch_size *= 2;
+  }
+
+  for (usize idx = 0; idx < benchmark_warmup_count; idx++) run_batch(batch_size);
+
+  Benchmark_Sample samples[benchmark_batches_count];
+  for (auto &sample: samples) sample = run_batch(batch_size);
+
+  sort_samples(samples);
+
+  auto &fastest = samples[0];
+  auto &median  = samples[benchmark_batches_count / 2];
+
+  auto local = runner.arena;
+  log("%: min % ns, median % ns, % cycles/byte (% ops per batch)\n",
+      name, fastest.nanos_per_op, median.nanos_per_op,
+      format_cycles_per_byte(local, median.cycles_per_op, bytes_per_op), batch_size);
+}
@@ -0,0 +1,189 @@
+
+#include "anyfin/base.hpp"
+#include "anyfin/arena.hpp"
+#include "anyfin/array_ops.hpp"
+#include "anyfin/file_system.hpp"
+#include "anyfin/format.hpp"
+#include "anyfin/memory.hpp"
+#include "anyfin/startup.hpp"
+#include "anyfin/string_builder.hpp"
+
+#include "code/cbuild.hpp"
+#include "code/build_system.hpp"
+#include "code/scanner.hpp"
+
+#include "harness.hpp"
+
+#include "anyfin/c_runtime_compat.hpp"
+
+/*
+  Micro benchmarks for the hot primitives of the builder. Pass a name, or a part of it, to run only matching benchmarks:
+
+    micro find_offset
+ */
+
+Panic_Handler panic_handler = terminate;
+
+bool silence_logs_opt    = false;
+bool tracing_enabled_opt = false;
+
+/*
+  Stands in for the builder's task execution, which isn't a part of the queue's cost.
+ */
+void build_target_task (Memory_Arena &, Build_System &, Build_Task task) {
+  do_not_optimize(task.timing_index);
+}
+
+static void find_offset_benchmarks (Benchmark_Runner &runner) {
+  const usize sizes [] { 64, 4096, 65536 };
+
+  for (auto size: sizes) {
+    auto keys = Array(reserve<u64>(runner.arena, size, 32), size);
+    for (usize idx = 0; idx < size; idx++) keys[idx] = (idx + 1) * 0x9e3779b97f4a7c15ull;
+
+    /*
+      The registry looks up files which are usually present, the last key is the worst case of such a lookup.
+     */
+    auto key = keys[size - 1];
+
+    run_benchmark(runner, format_string(runner.arena, "find_offset/%", size), size * sizeof(u64), [&] (Memory_Arena &) {
+      do_not_optimize(find_offset(keys, key));
+    });
+  }
+}
+
+/*
+  Source file resembling real code: includes interleaved with comments, string literals and code.
+ */
+static String generate_source_file (Memory_Arena &arena, usize includes_count, usize filler_lines_count) {
+  String_Builder builder { arena };
+
+  for (usize idx = 0; idx < includes_count; idx++) {
+    builder.add(arena, "#include \"module/header_", idx, ".hpp\"\n");
+    builder.add(arena, "// #include \"commented_out.hpp\"\n");
+
+    for (usize line = 0; line < filler_lines_count; line++) {
+      builder.add(arena, "static const char *value_", idx, "_", line, " = \"#include <not_an_include>\"; /* block */\n");
+    }
+  }
+
+  return build_string(arena, builder);
+}
+
+static void scanner_benchmarks (Benchmark_Runner &runner) {
+  struct { usize includes; usize filler; } shapes [] { { 8, 4 }, { 64, 32 } };
+
+  File file {};
+
+  for (auto [includes, filler]: shapes) {
+    auto source = generate_source_file(runner.arena, includes, filler);
+
+    auto name = format_string(runner.arena, "get_next_include_value/% includes, % bytes", includes, source.length);
+    run_benchmark(runner, name, source.length, [&] (Memory_Arena &) {
+      Dependency_Iterator iterator { file, File_Mapping { .memory = const_cast<char *>(source.value), .size = source.length } };
+
+      usize found = 0;
+      while (true) {
+        auto [has_value, value] = get_next_include_value(iterator);
+        if (!has_value) break;
+
+        found += value.length;
+      }
+
+      do_not_optimize(found);
+    });
+  }
+}
+
+static void build_queue_benchmarks (Benchmark_Runner &runner) {
+  constexpr usize tasks_count = 1024;
+
+  const auto submit_all = [] (Build_System &system) {
+    for (usize idx = 0; idx < tasks_count; idx++) {
+      system.submit_task(Build_Task { .type = Build_Task::Compile, .timing_index = static_cast<u32>(idx) });
+    }
+  };
+
+  /*
+    Main thread alone, measures the cost of the queue's operations without contention.
+   */
+  {
+    auto local = runner.arena;
+    Build_System system { local, tasks_count, 0 };
+
+    auto arena = make_sub_arena(local, Build_System::RESERVATION_SIZE);
+    Benchmark_Runner queue_runner { local, runner.filter };
+
+    run_benchmark(queue_runner, "build_queue/1 thread, 1024 tasks", 0, [&] (Memory_Arena &) {
+      submit_all(system);
+      while (system.has_unfinished_tasks()) system.execute_task(arena);
+    });
+  }
+
+  /*
+    Main thread submits tasks while builders drain the queue, same as during the build.
+   */
+  {
+    auto local = runner.arena;
+    Build_System system { local, tasks_count, 3 };
+
+    auto arena = make_sub_arena(local, Build_System::RESERVATION_SIZE);
+    Benchmark_Runner queue_runner { local, runner.filter };
+
+    run_benchmark(queue_runner, "build_queue/4 threads, 1024 tasks", 0, [&] (Memory_Arena &) {
+      submit_all(system);
+      while (system.has_unfinished_tasks()) system.execute_task(arena);
+    });
+
+    system.shutdown();
+  }
+}
+
+static void string_benchmarks (Benchmark_Runner &runner) {
+  const String segments [] { "C:\\Projects\\cbuild", ".cbuild", "project", "build", "obj", "library1", "library1.cpp.obj" };
+
+  usize segments_length = 0;
+  for (auto segment: segments) segments_length += segment.length;
+
+  run_benchmark(runner, "string_builder/build_string, 7 sections", segments_length, [&] (Memory_Arena &arena) {
+    String_Builder builder { arena };
+    for (auto segment: segments) builder += segment;
+
+    do_not_optimize(build_string(arena, builder).length);
+  });
+
+  run_benchmark(runner, "string_builder/build_string_with_separator, 7 sections", segments_length, [&] (Memory_Arena &arena) {
+    String_Builder builder { arena };
+    for (auto segment: segments) builder += segment;
+
+    do_not_optimize(build_string_with_separator(arena, builder, ' ').length);
+  });
+
+  run_benchmark(runner, "format_string/4 arguments", 0, [&] (Memory_Arena &arena) {
+    do_not_optimize(format_string(arena, "TRACE(#%): Picking up file % for target % (% pending)\n", 12345, segments[6], segments[5], 42).length);
+  });
+
+  run_benchmark(runner, "make_file_path/7 segments", segments_length, [&] (Memory_Arena &arena) {
+    do_not_optimize(make_file_path(arena, segments[0], segments[1], segments[2], segments[3], segments[4], segments[5], segments[6]).length);
+  });
+}
+
+static u32 run_micro_benchmarks () {
+  Memory_Arena arena { reserve_virtual_memory(megabytes(64)) };
+
+  auto args = get_startup_args(arena);
+
+  Benchmark_Runner runner { arena };
+  if (args.count) runner.filter = args[0].key;
+
+  find_offset_benchmarks(runner);
+  scanner_benchmarks(runner);
+  build_queue_benchmarks(runner);
+  string_benchmarks(runner);
+
+  return 0;
+}
+
+int mainCRTStartup () {
+  terminate(run_micro_benchmarks());
+}
@@ -11,5 +11,16 @@ extern "C" bool setup_project (const Arguments *args, Project *project) {
   add_source_file(target, "code/main.cpp");
   add_linker_option(target, "libcmt.lib");
 
+  /*
+    Tools for the scaling benchmarks, see run_scaling.ps1.
+   */
+  auto generator = add_executable(project, "generator");
+  add_source_file(generator, "code/generator.cpp");
+  add_linker_option(generator, "libcmt.lib");
+
+  auto stub_compiler = add_executable(project, "stub_compiler");
+  add_source_file(stub_compiler, "code/stub_compiler.cpp");
+  add_linker_option(stub_compiler, "libcmt.lib");
+
   return true;
 }
@@ -0,0 +1,124 @@
+
+# Measures cbuild's own overhead on a generated project of the requested size. Tools are built by cbuild from this
+# folder's project, the generated project uses the stub compiler by default, pass -RealToolchain to use clang instead.
+# With -NullToolchain cbuild doesn't start any tools at all, which also excludes the cost of process creation.
+#
+# Example:
+#   .\run_scaling.ps1 -Targets 64 -Files 64 -Output results.json
+
+param(
+    [string] $Cbuild      = "cbuild",
+    [string] $Workspace   = ".\out\scaling",
+    [string] $Output      = ".\out\scaling.json",
+    [int]    $Targets     = 16,
+    [int]    $Files       = 32,
+    [int]    $Headers     = 16,
+    [int]    $Depth       = 4,
+    [int]    $FanIn       = 4,
+    [int]    $FanOut      = 2,
+    [int]    $Deps        = 2,
+    [int]    $Builders    = 0,
+    [int]    $StubDelay   = 0,
+    [int]    $Iterations  = 3,
+    [switch] $RealToolchain,
+    [switch] $NullToolchain
+)
+
+$ErrorActionPreference = "Stop"
+
+$bench_root = $PSScriptRoot
+
+function Invoke-Cbuild([string[]] $arguments) {
+    & $Cbuild @arguments | Out-Null
+    if ($LASTEXITCODE -ne 0) { throw "cbuild $($arguments -join ' ') failed with exit code $LASTEXITCODE" }
+}
+
+function Measure-Scenario([string] $name, [scriptblock] $prepare, [string[]] $arguments) {
+    $samples = @()
+
+    for ($idx = 0; $idx -lt $Iterations; $idx++) {
+        & $prepare
+        $elapsed  = Measure-Command { Invoke-Cbuild (@("build") + $build_arguments + $arguments) }
+        $samples += [math]::Round($elapsed.TotalMilliseconds, 3)
+    }
+
+    $sorted = $samples | Sort-Object
+    Write-Host ("{0,-14} min {1,10:F3}ms  median {2,10:F3}ms  max {3,10:F3}ms" -f $name, $sorted[0], $sorted[[int]($sorted.Count / 2)], $sorted[-1])
+
+    return [ordered]@{
+        min_ms    = $sorted[0]
+        median_ms = $sorted[[int]($sorted.Count / 2)]
+        max_ms    = $sorted[-1]
+        samples   = $samples
+    }
+}
+
+Push-Location $bench_root
+try {
+    Invoke-Cbuild @("build")
+} finally {
+    Pop-Location
+}
+
+$tools_folder  = Join-Path $bench_root ".cbuild\project\build\out"
+$generator     = Join-Path $tools_folder "generator.exe"
+$stub_compiler = Join-Path $tools_folder "stub_compiler.exe"
+
+if (Test-Path -Path $Workspace) { Remove-Item -Recurse -Force $Workspace }
+
+$parent = Split-Path -Parent $Workspace
+if ($parent -and !(Test-Path -Path $parent)) { New-Item -ItemType Directory -Path $parent | Out-Null }
+
+& $generator "out=$Workspace" "targets=$Targets" "files=$Files" "headers=$Headers" "depth=$Depth" "fan_in=$FanIn" "fan_out=$FanOut" "deps=$Deps"
+if ($LASTEXITCODE -ne 0) { throw "Project generation failed" }
+
+$output_path = [System.IO.Path]::GetFullPath((Join-Path (Get-Location) $Output))
+
+$build_arguments = @()
+if     ($NullToolchain) { $build_arguments += "null_toolchain=$StubDelay" }
+elseif (!$RealToolchain) { $build_arguments += "stub=$stub_compiler" }
+if ($Builders -gt 0) { $build_arguments += "builders=$Builders" }
+
+$env:CBUILD_STUB_DELAY = "$StubDelay"
+
+Push-Location $Workspace
+try {
+    Invoke-Cbuild @("update")
+
+    # Builds the project's configuration, so it doesn't count towards the first measured build.
+    Invoke-Cbuild (@("build") + $build_arguments)
+
+    $touched_header = Resolve-Path "code\shared\h0_0.hpp"
+    $touch_header   = { (Get-Item $touched_header).LastWriteTime = Get-Date }
+
+    $results = [ordered]@{}
+    $results.cold          = Measure-Scenario "cold"          { Invoke-Cbuild @("clean") } @()
+    $results.noop          = Measure-Scenario "noop"          { } @()
+    $results.header_touch  = Measure-Scenario "header_touch"  $touch_header @()
+    $results.targeted      = Measure-Scenario "targeted"      $touch_header @("targets=lib0")
+} finally {
+    Pop-Location
+    Remove-Item Env:\CBUILD_STUB_DELAY
+}
+
+$report = [ordered]@{
+    timestamp  = (Get-Date).ToUniversalTime().ToString("o")
+    toolchain  = $(if ($NullToolchain) { "null" } elseif ($RealToolchain) { "llvm" } else { "stub" })
+    parameters = [ordered]@{
+        targets    = $Targets
+        files      = $Files
+        headers    = $Headers
+        depth      = $Depth
+        fan_in     = $FanIn
+        fan_out    = $FanOut
+        deps       = $Deps
+        builders   = $Builders
+        stub_delay = $StubDelay
+        iterations = $Iterations
+    }
+    results    = $results
+}
+
+$report | ConvertTo-Json -Depth 4 | Set-Content -Path $output_path -Encoding utf8
+
+Write-Host "Results were written into $output_path"
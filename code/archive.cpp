@@ -0,0 +1,513 @@
+#include "anyfin/base.hpp"
+#include "anyfin/array.hpp"
+#include "anyfin/defer.hpp"
+#include "anyfin/format.hpp"
+#include "anyfin/hash.hpp"
+#include "anyfin/memory.hpp"
+#include "anyfin/string_builder.hpp"
+
+#include "archive.hpp"
+
+/*
+  Both COFF and GNU archives start with the signature, followed by members, each with a textual header. The first member
+  of an archive with a symbol table is the linker member named "/", which lists every symbol defined by the archive.
+ */
+constexpr char  archive_signature []   = "!<arch>\n";
+constexpr usize archive_signature_size = sizeof(archive_signature) - 1;
+
+/*
+  Thin archives have a signature of their own, otherwise the linker would read member headers as if objects followed.
+ */
+constexpr char thin_archive_signature [] = "!<thin>\n";
+
+static_assert(sizeof(thin_archive_signature) - 1 == archive_signature_size);
+
+struct Archive_Member_Header {
+  char name[16];
+  char date[12];
+  char user_id[6];
+  char group_id[6];
+  char mode[8];
+  char size[10];
+  char end[2];
+};
+
+static_assert(sizeof(Archive_Member_Header) == 60);
+
+static u32 read_big_endian_u32 (const char *memory) {
+  auto bytes = reinterpret_cast<const u8 *>(memory);
+  return (u32(bytes[0]) << 24) | (u32(bytes[1]) << 16) | (u32(bytes[2]) << 8) | u32(bytes[3]);
+}
+
+static u16 read_little_endian_u16 (const char *memory) {
+  auto bytes = reinterpret_cast<const u8 *>(memory);
+  return u16(bytes[0]) | u16(u16(bytes[1]) << 8);
+}
+
+static u32 read_little_endian_u32 (const char *memory) {
+  auto bytes = reinterpret_cast<const u8 *>(memory);
+  return u32(bytes[0]) | (u32(bytes[1]) << 8) | (u32(bytes[2]) << 16) | (u32(bytes[3]) << 24);
+}
+
+static u64 read_little_endian_u64 (const char *memory) {
+  return u64(read_little_endian_u32(memory)) | (u64(read_little_endian_u32(memory + 4)) << 32);
+}
+
+static void write_big_endian_u32 (char *memory, u32 value) {
+  auto bytes = reinterpret_cast<u8 *>(memory);
+  bytes[0] = u8(value >> 24);
+  bytes[1] = u8(value >> 16);
+  bytes[2] = u8(value >> 8);
+  bytes[3] = u8(value);
+}
+
+static Option<usize> parse_member_size (const Archive_Member_Header &header) {
+  usize size = 0;
+  bool  has_digits = false;
+
+  for (auto c: header.size) {
+    if (c == ' ') break;
+    if (c < '0' || c > '9') return opt_none;
+
+    size = size * 10 + usize(c - '0');
+    has_digits = true;
+  }
+
+  if (!has_digits) return opt_none;
+
+  return size;
+}
+
+Option<u64> get_import_library_interface_hash (File_Path import_library_path) {
+  auto [open_error, file] = open_file(import_library_path);
+  if (open_error) return opt_none;
+
+  defer { close_file(file); };
+
+  auto [mapping_error, mapping] = map_file_into_memory(file);
+  if (mapping_error) return opt_none;
+
+  defer { unmap_file(mapping); };
+
+  const auto header_offset = archive_signature_size;
+  const auto table_offset  = header_offset + sizeof(Archive_Member_Header);
+
+  if (mapping.size < table_offset + sizeof(u32))                            return opt_none;
+  if (!(String(mapping.memory, archive_signature_size) == archive_signature)) return opt_none;
+
+  auto header = reinterpret_cast<const Archive_Member_Header *>(mapping.memory + header_offset);
+  if (header->name[0] != '/' || header->name[1] != ' ') return opt_none;
+
+  auto [has_size, member_size] = parse_member_size(*header);
+  if (!has_size || table_offset + member_size > mapping.size) return opt_none;
+
+  /*
+    Linker member is the big-endian count of symbols, followed by the offsets of members defining each symbol, followed
+    by null-terminated names of symbols. Offsets change with any change of the library's content, only names are hashed.
+   */
+  auto table = mapping.memory + table_offset;
+  auto end   = table + member_size;
+
+  auto symbols_count = usize(read_big_endian_u32(table));
+  if (sizeof(u32) * (symbols_count + 1) > member_size) return opt_none;
+
+  auto cursor = table + sizeof(u32) * (symbols_count + 1);
+
+  /*
+    Symbols are combined with addition, thus the same set of exports gives the same hash in any order.
+   */
+  u64 interface_hash = hash_value(symbols_count);
+  for (usize idx = 0; idx < symbols_count; idx++) {
+    auto name_start = cursor;
+    while (cursor < end && *cursor) cursor++;
+
+    if (cursor == end) return opt_none;
+
+    interface_hash += hash_string(String(name_start, usize(cursor - name_start))) * 0x9e3779b97f4a7c15ull;
+    cursor += 1;
+  }
+
+  return interface_hash;
+}
+
+/*
+  Symbol names point into the mapped objects, thus these are valid only until the objects are unmapped.
+ */
+struct Archive_Symbol {
+  String name;
+  u32    member_index;
+};
+
+static String read_null_terminated_string (const char *start, const char *end) {
+  auto cursor = start;
+  while (cursor < end && *cursor) cursor++;
+
+  return String(start, usize(cursor - start));
+}
+
+/*
+  Objects starting with the anonymous header are either regular objects with the extended sections count, i.e /bigobj,
+  or something the archiver must handle itself, e.g MSVC's LTCG objects.
+ */
+constexpr u8 coff_bigobj_class_id [] { 0xc7, 0xa1, 0xba, 0xd1, 0xee, 0xba, 0xa9, 0x4b, 0xaf, 0x20, 0xfa, 0xf6, 0x6a, 0xa4, 0xdc, 0xb8 };
+
+constexpr u8 coff_external_storage_class = 2;
+
+static bool collect_coff_symbols (const File_Mapping &object, u32 member_index, List<Archive_Symbol> &symbols) {
+  const auto memory = object.memory;
+  const auto size   = object.size;
+
+  if (size < 20) return false;
+
+  usize symbol_table_offset = 0;
+  usize symbols_count       = 0;
+  usize symbol_size         = 0;
+
+  if (read_little_endian_u16(memory) == 0 && read_little_endian_u16(memory + 2) == 0xffff) {
+    if (size < 56 || read_little_endian_u16(memory + 4) < 2) return false;
+    if (!compare_bytes(reinterpret_cast<const u8 *>(memory + 12), coff_bigobj_class_id, sizeof(coff_bigobj_class_id))) return false;
+
+    /*
+      Extended header has the sections count at +44, followed by the symbol table's offset and the symbols count.
+     */
+    symbol_table_offset = read_little_endian_u32(memory + 48);
+    symbols_count       = read_little_endian_u32(memory + 52);
+    symbol_size         = 20;
+  }
+  else {
+    switch (read_little_endian_u16(memory)) {
+      case 0x014c: // x86
+      case 0x8664: // x64
+      case 0x01c4: // ARMv7
+      case 0xaa64: // ARM64
+        break;
+      default: return false;
+    }
+
+    symbol_table_offset = read_little_endian_u32(memory + 8);
+    symbols_count       = read_little_endian_u32(memory + 12);
+    symbol_size         = 18;
+  }
+
+  if (symbols_count == 0) return true;
+
+  /*
+    String table, which holds names longer than 8 characters, follows the symbol table.
+   */
+  const auto string_table_offset = symbol_table_offset + symbols_count * symbol_size;
+  if (string_table_offset + sizeof(u32) > size) return false;
+
+  const auto end = memory + size;
+
+  for (usize idx = 0; idx < symbols_count; idx++) {
+    auto symbol = memory + symbol_table_offset + idx * symbol_size;
+
+    auto value          = read_little_endian_u32(symbol + 8);
+    auto section_number = (symbol_size == 20) ? s32(read_little_endian_u32(symbol + 12)) : s32(s16(read_little_endian_u16(symbol + 12)));
+    auto storage_class  = u8(symbol[symbol_size - 2]);
+
+    idx += u8(symbol[symbol_size - 1]); // auxiliary records of the symbol
+
+    /*
+      Undefined external symbols with a value are common symbols, the value is the symbol's size.
+     */
+    if (storage_class != coff_external_storage_class) continue;
+    if (section_number == 0 && value == 0)            continue;
+
+    String name;
+    if (read_little_endian_u32(symbol) == 0) {
+      auto name_offset = string_table_offset + read_little_endian_u32(symbol + 4);
+      if (name_offset >= size) return false;
+
+      name = read_null_terminated_string(memory + name_offset, end);
+    }
+    else {
+      name = read_null_terminated_string(symbol, symbol + 8);
+    }
+
+    list_push(symbols, Archive_Symbol { .name = name, .member_index = member_index });
+  }
+
+  return true;
+}
+
+constexpr u32 elf_symbol_table_section = 2;
+
+constexpr u8 elf_global_binding = 1;
+constexpr u8 elf_weak_binding   = 2;
+constexpr u8 elf_unique_binding = 10;
+
+static bool collect_elf_symbols (const File_Mapping &object, u32 member_index, List<Archive_Symbol> &symbols) {
+  const auto memory = object.memory;
+  const auto size   = object.size;
+
+  if (size < 64 || !(String(memory, 4) == "\x7f" "ELF")) return false;
+  if (memory[4] != 2 || memory[5] != 1) return false; // only 64-bit little-endian objects
+
+  const usize sections_offset = read_little_endian_u64(memory + 0x28);
+  const usize section_size    = read_little_endian_u16(memory + 0x3a);
+  const usize sections_count  = read_little_endian_u16(memory + 0x3c);
+
+  if (section_size < 64 || sections_offset + sections_count * section_size > size) return false;
+
+  for (usize section_index = 0; section_index < sections_count; section_index++) {
+    auto section = memory + sections_offset + section_index * section_size;
+    if (read_little_endian_u32(section + 4) != elf_symbol_table_section) continue;
+
+    const usize table_offset  = read_little_endian_u64(section + 24);
+    const usize table_size    = read_little_endian_u64(section + 32);
+    const usize strings_index = read_little_endian_u32(section + 40);
+    const usize entry_size    = read_little_endian_u64(section + 56);
+
+    if (entry_size < 24 || table_offset + table_size > size || strings_index >= sections_count) return false;
+
+    auto strings_section = memory + sections_offset + strings_index * section_size;
+
+    const usize strings_offset = read_little_endian_u64(strings_section + 24);
+    const usize strings_size   = read_little_endian_u64(strings_section + 32);
+
+    if (strings_offset + strings_size > size) return false;
+
+    /*
+      The first entry of the table is always the null symbol.
+     */
+    for (usize offset = entry_size; offset + entry_size <= table_size; offset += entry_size) {
+      auto symbol = memory + table_offset + offset;
+
+      auto binding        = u8(symbol[4]) >> 4;
+      auto symbol_section = read_little_endian_u16(symbol + 6);
+
+      if (symbol_section == 0) continue; // undefined
+      if (binding != elf_global_binding && binding != elf_weak_binding && binding != elf_unique_binding) continue;
+
+      auto name_offset = read_little_endian_u32(symbol);
+      if (name_offset >= strings_size) return false;
+
+      auto name = read_null_terminated_string(memory + strings_offset + name_offset, memory + strings_offset + strings_size);
+      if (name.length == 0) continue;
+
+      list_push(symbols, Archive_Symbol { .name = name, .member_index = member_index });
+    }
+  }
+
+  return true;
+}
+
+/*
+  Member headers are written the way deterministic archives are, i.e without timestamps and owners, so the archive's
+  content depends only on the objects.
+ */
+static void fill_member_header (Archive_Member_Header &header, String name, u64 size) {
+  auto bytes = reinterpret_cast<char *>(&header);
+  for (usize idx = 0; idx < sizeof(Archive_Member_Header); idx++) bytes[idx] = ' ';
+
+  fin_ensure(name.length <= sizeof(header.name));
+  copy_memory(header.name, name.value, name.length);
+
+  header.date[0]     = '0';
+  header.user_id[0]  = '0';
+  header.group_id[0] = '0';
+  copy_memory(header.mode, "644", 3);
+
+  char digits[20];
+  usize digits_count = 0;
+  do {
+    digits[digits_count++] = char('0' + size % 10);
+    size /= 10;
+  } while (size);
+
+  fin_ensure(digits_count <= sizeof(header.size));
+  for (usize idx = 0; idx < digits_count; idx++) header.size[idx] = digits[digits_count - idx - 1];
+
+  header.end[0] = '`';
+  header.end[1] = '\n';
+}
+
+Sys_Result<bool> write_static_archive (Memory_Arena &arena, File_Path output_path, const List<File_Path> &objects, bool thin) {
+  using enum File_System_Flags;
+
+  if (objects.count == 0) return false;
+
+  struct Member {
+    File         file;
+    File_Mapping mapping;
+    String       name;
+    u64          offset;
+  };
+
+  auto members = reserve_array<Member>(arena, objects.count);
+  usize mapped_count = 0;
+
+  defer {
+    for (usize idx = 0; idx < mapped_count; idx++) {
+      unmap_file(members[idx].mapping);
+      close_file(members[idx].file);
+    }
+  };
+
+  List<Archive_Symbol> symbols    { arena };
+  String_Builder       long_names { arena };
+
+  for (auto &path: objects) {
+    auto &member = members[mapped_count];
+
+    auto [open_error, file] = open_file(path);
+    if (open_error) return move(open_error.value);
+
+    auto [mapping_error, mapping] = map_file_into_memory(file);
+    if (mapping_error) {
+      close_file(file);
+      return move(mapping_error.value);
+    }
+
+    member.file    = file;
+    member.mapping = mapping;
+
+    const auto member_index = static_cast<u32>(mapped_count++);
+
+    if (!collect_coff_symbols(mapping, member_index, symbols) &&
+        !collect_elf_symbols(mapping, member_index, symbols)) return false;
+
+    /*
+      Names that don't fit into the header, and every name of a thin archive, i.e the object's path, are placed into
+      the long names member, which the header references by the offset.
+     */
+    String name;
+    if (thin) {
+      auto [path_error, absolute_path] = get_absolute_path(arena, path);
+      if (path_error) return move(path_error.value);
+
+      name = absolute_path;
+    }
+    else {
+      auto [name_error, file_name] = get_resource_name(path);
+      if (name_error) return move(name_error.value);
+
+      name = file_name;
+    }
+
+    if (thin || name.length + 1 > sizeof(Archive_Member_Header::name)) {
+      member.name = format_string(arena, "/%", long_names.length);
+      long_names.add(arena, name, "/\n");
+    }
+    else {
+      member.name = concat_string(arena, name, "/");
+    }
+  }
+
+  const u64 header_size = sizeof(Archive_Member_Header);
+
+  u64 symbol_table_size = sizeof(u32) * (symbols.count + 1);
+  for (auto &symbol: symbols) symbol_table_size += symbol.name.length + 1;
+
+  u64 offset = archive_signature_size;
+  if (symbols.count)     offset += header_size + align_forward(symbol_table_size, 2);
+  if (long_names.length) offset += header_size + align_forward(u64(long_names.length), 2);
+
+  for (auto &member: members) {
+    member.offset = offset;
+
+    offset += header_size;
+    if (!thin) offset += align_forward(u64(member.mapping.size), 2);
+  }
+
+  /*
+    Offsets in the symbol table are 32-bit, larger archives are left to the archiver.
+   */
+  if (offset > 0xffffffffull) return false;
+
+  /*
+    Everything up to the first object's data is put together in memory, for a thin archive that's the whole archive.
+   */
+  auto head   = reserve_array<char>(arena, thin ? offset : members[0].offset + header_size);
+  auto cursor = head.values;
+
+  const auto write_header = [&cursor] (String name, u64 size) {
+    fill_member_header(*reinterpret_cast<Archive_Member_Header *>(cursor), name, size);
+    cursor += sizeof(Archive_Member_Header);
+  };
+
+  copy_memory(cursor, thin ? thin_archive_signature : archive_signature, archive_signature_size);
+  cursor += archive_signature_size;
+
+  if (symbols.count) {
+    write_header("/", symbol_table_size);
+
+    write_big_endian_u32(cursor, static_cast<u32>(symbols.count));
+    cursor += sizeof(u32);
+
+    for (auto &symbol: symbols) {
+      write_big_endian_u32(cursor, static_cast<u32>(members[symbol.member_index].offset));
+      cursor += sizeof(u32);
+    }
+
+    for (auto &symbol: symbols) {
+      copy_memory(cursor, symbol.name.value, symbol.name.length);
+      cursor += symbol.name.length;
+      *cursor++ = '\0';
+    }
+
+    if (symbol_table_size % 2) *cursor++ = '\n';
+  }
+
+  if (long_names.length) {
+    write_header("//", long_names.length);
+
+    for (auto &section: long_names.sections) {
+      copy_memory(cursor, section.value, section.length);
+      cursor += section.length;
+    }
+
+    if (long_names.length % 2) *cursor++ = '\n';
+  }
+
+  if (thin) {
+    for (auto &member: members) write_header(member.name, member.mapping.size);
+  }
+  else {
+    write_header(members[0].name, members[0].mapping.size);
+  }
+
+  fin_ensure(cursor == head.values + head.count);
+
+  auto [open_error, output] = open_file(output_path, Write_Access | Always_New);
+  if (open_error) return move(open_error.value);
+
+  /*
+    Partially written archive must not be mistaken for a valid output by the next build.
+   */
+  const auto discard_output = [&] (System_Error error) -> Sys_Result<bool> {
+    close_file(output);
+    delete_file(output_path);
+    return move(error);
+  };
+
+  if (auto result = write_bytes_to_file(output, head.values, head.count); result.is_error())
+    return discard_output(move(result.error.value));
+
+  if (!thin) {
+    for (usize idx = 0; idx < members.count; idx++) {
+      auto &member = members[idx];
+
+      if (idx > 0) {
+        Archive_Member_Header header;
+        fill_member_header(header, member.name, member.mapping.size);
+
+        if (auto result = write_bytes_to_file(output, reinterpret_cast<const char *>(&header), sizeof(header)); result.is_error())
+          return discard_output(move(result.error.value));
+      }
+
+      if (auto result = write_bytes_to_file(output, member.mapping.memory, member.mapping.size); result.is_error())
+        return discard_output(move(result.error.value));
+
+      if (member.mapping.size % 2) {
+        if (auto result = write_bytes_to_file(output, "\n", 1); result.is_error())
+          return discard_output(move(result.error.value));
+      }
+    }
+  }
+
+  close_file(output);
+
+  return true;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "anyfin/base.hpp"
+#include "anyfin/arena.hpp"
+#include "anyfin/file_system.hpp"
+#include "anyfin/list.hpp"
+#include "anyfin/option.hpp"
+
+#include "cbuild.hpp"
+
+/*
+  Hash of the symbols exported through the import library, i.e the part of a shared library downstream targets are
+  linked against. The order of symbols doesn't affect the hash. Returns none if the file doesn't exist or isn't an
+  archive with a symbol table.
+ */
+Option<u64> get_import_library_interface_hash (File_Path import_library_path);
+
+/*
+  Writes a static library out of the given object files without running the archiver. Both COFF libraries and GNU
+  archives share the layout written here, i.e the linker member with the symbol table, followed by the long names
+  member and object files. Thin archive only references the objects by their absolute paths, instead of copying them.
+
+  Symbols are read from COFF and 64-bit ELF objects, returns false if some object has a different format, e.g LTO
+  bitcode, in which case nothing is written and it's up to the caller to run the archiver.
+ */
+Sys_Result<bool> write_static_archive (Memory_Arena &arena, File_Path output_path, const List<File_Path> &objects, bool thin);
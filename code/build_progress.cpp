@@ -0,0 +1,544 @@
+
+#include "anyfin/base.hpp"
+#include "anyfin/array.hpp"
+#include "anyfin/atomics.hpp"
+#include "anyfin/concurrent.hpp"
+#include "anyfin/console.hpp"
+#include "anyfin/defer.hpp"
+#include "anyfin/hash.hpp"
+#include "anyfin/memory.hpp"
+#include "anyfin/string_builder.hpp"
+#include "anyfin/threads.hpp"
+#include "anyfin/timers.hpp"
+
+#include "build_progress.hpp"
+
+extern bool silence_logs_opt;
+
+enum struct Slot_State: u32 { Unused, Pending, Running, Done };
+
+struct Progress_Slot {
+  Atomic<Slot_State> state;
+
+  /*
+    Duration of the same task from the history, zero if it's unknown.
+   */
+  u32 estimate_us;
+  u32 duration_us;
+  b32 executed;
+
+  u64 started_at;
+};
+
+/*
+  History file is the header followed by the records, keys are hashes of file paths for compile tasks, of target names
+  for link tasks and of target names with the batch's number for archive tasks.
+ */
+struct History_Header {
+  u32 version;
+  u32 records_count;
+};
+
+struct History_Record {
+  u64 key;
+  u32 duration_us;
+  u32 _reserved;
+};
+
+constexpr u32 history_version = 1;
+
+/*
+  Status line is capped, wider terminals don't get anything useful past this point anyway.
+ */
+constexpr usize status_line_capacity = 512;
+
+/*
+  How often the status line is redrawn, in milliseconds. This also bounds the time it takes to stop the renderer.
+ */
+constexpr u32 status_refresh_interval = 50;
+
+struct Build_Progress {
+  bool enabled;
+
+  Progress_Mode mode;
+
+  u64 frequency;
+
+  Slice<Task_Timing>   tasks;
+  Array<Progress_Slot> slots;
+  u32 first_link_index;
+  u32 workers_count;
+  u32 tasks_count;
+  u64 started_at;
+
+  au32 finished_count;
+  au32 executed_count;
+  au64 executed_time_us;
+
+  /*
+    Number of tenths of the build reported in the compact mode.
+   */
+  au32 reported_step;
+
+  File_Path history_file_path;
+  bool      targeted_build;
+
+  /*
+    Open addressing table of the history records, with zero keys marking empty slots. Records claimed by the current
+    build's tasks are marked, others are carried over to the next history only by targeted builds.
+   */
+  Array<History_Record> history;
+  Array<b32>            history_claimed;
+  u64                   history_average_us;
+
+  u32           terminal_width;
+  Spin_Lock     lock;
+  Thread        renderer;
+  au32          stopping;
+  Memory_Region render_region;
+
+  char  status_line[status_line_capacity];
+  usize status_line_length;
+  usize drawn_length;
+};
+
+static Build_Progress build_progress;
+
+static u64 to_micros (u64 ticks) {
+  return (ticks * 1'000'000) / build_progress.frequency;
+}
+
+static bool is_link_task (u32 index) {
+  return index >= build_progress.first_link_index;
+}
+
+static u64 get_task_key (u32 index) {
+  auto &name = build_progress.tasks[index].name;
+
+  return make_table_key(is_link_task(index) ? hash_string(name, hash_string("link")) : hash_string(name));
+}
+
+static usize find_history_slot (u64 key) {
+  return find_table_slot(build_progress.history, key);
+}
+
+static Array<u8> load_history_file (Memory_Arena &arena, File_Path path) {
+  auto [open_error, file] = open_file(path);
+  if (open_error) return {};
+
+  defer { close_file(file); };
+
+  auto [read_error, content] = get_file_content(arena, file);
+  if (read_error) {
+    log("WARNING: Couldn't read build timings from % due to an error: %\n", path, read_error.value);
+    return {};
+  }
+
+  return content;
+}
+
+static void load_history (Memory_Arena &arena) {
+  auto &progress = build_progress;
+
+  Slice<History_Record> records;
+
+  auto content = load_history_file(arena, progress.history_file_path);
+  if (content.count >= sizeof(History_Header)) {
+    auto header = reinterpret_cast<const History_Header *>(content.values);
+
+    /*
+      Outdated or damaged history is dropped, it's only used for estimates and is rewritten at the end of the build.
+     */
+    auto expected_size = sizeof(History_Header) + usize(header->records_count) * sizeof(History_Record);
+    if (header->version == history_version && content.count == expected_size) {
+      records = Slice(reinterpret_cast<History_Record *>(content.values + sizeof(History_Header)), header->records_count);
+    }
+  }
+
+  /*
+    The table should fit both the old records and records of the current build, with enough room for short probes.
+   */
+  usize capacity = (records.count + progress.tasks_count) * 2;
+  capacity = align_forward_to_pow_2(capacity < 64 ? 64 : capacity);
+
+  progress.history         = reserve_array<History_Record>(arena, capacity);
+  progress.history_claimed = reserve_array<b32>(arena, capacity);
+  zero_memory(progress.history.values, progress.history.count);
+  zero_memory(progress.history_claimed.values, progress.history_claimed.count);
+
+  for (auto &record: records) {
+    if (record.key == 0) continue;
+    progress.history[find_history_slot(record.key)] = record;
+  }
+
+  u64 known_total = 0;
+  u32 known_count = 0;
+
+  for (u32 idx = 0; idx < progress.slots.count; idx++) {
+    auto &slot = progress.slots[idx];
+    if (slot.state.value == Slot_State::Unused) continue;
+
+    auto position = find_history_slot(get_task_key(idx));
+    if (progress.history[position].key == 0) continue;
+
+    slot.estimate_us = progress.history[position].duration_us;
+    progress.history_claimed[position] = true;
+
+    known_total += slot.estimate_us;
+    known_count += 1;
+  }
+
+  progress.history_average_us = known_count ? known_total / known_count : 0;
+}
+
+static void save_history () {
+  using enum File_System_Flags;
+
+  auto &progress = build_progress;
+
+  for (u32 idx = 0; idx < progress.slots.count; idx++) {
+    auto &slot = progress.slots[idx];
+    if (slot.state.value != Slot_State::Done || !slot.executed) continue;
+
+    auto key      = get_task_key(idx);
+    auto position = find_history_slot(key);
+
+    progress.history[position]         = History_Record { .key = key, .duration_us = slot.duration_us };
+    progress.history_claimed[position] = true;
+  }
+
+  auto region = reserve_virtual_memory(sizeof(History_Header) + progress.history.count * sizeof(History_Record));
+  if (!region.memory) {
+    log("WARNING: Couldn't reserve memory to save build timings\n");
+    return;
+  }
+
+  defer { free_virtual_memory(region); };
+
+  auto header  = reinterpret_cast<History_Header *>(region.memory);
+  auto records = reinterpret_cast<History_Record *>(region.memory + sizeof(History_Header));
+
+  /*
+    Records of files and targets that are no longer in the project are dropped by full builds, targeted builds don't
+    know about other targets, thus keep everything.
+   */
+  u32 count = 0;
+  for (usize idx = 0; idx < progress.history.count; idx++) {
+    auto &record = progress.history[idx];
+    if (record.key == 0) continue;
+    if (!progress.history_claimed[idx] && !progress.targeted_build) continue;
+
+    records[count++] = record;
+  }
+
+  *header = History_Header { .version = history_version, .records_count = count };
+
+  auto [open_error, file] = open_file(progress.history_file_path, Write_Access | Always_New);
+  if (open_error) {
+    log("WARNING: Couldn't save build timings into % due to an error: %\n", progress.history_file_path, open_error.value);
+    return;
+  }
+
+  defer { close_file(file); };
+
+  auto size = sizeof(History_Header) + count * sizeof(History_Record);
+  if (auto result = write_bytes_to_file(file, region.memory, size); result.is_error())
+    log("WARNING: Couldn't save build timings into % due to an error: %\n", progress.history_file_path, result.error.value);
+}
+
+/*
+  Remaining time is the sum of estimates of pending tasks and the rest of estimates of running tasks, spread over all
+  builders. Tasks missing from the history are assumed to take as long as an average task.
+ */
+static Option<u64> estimate_remaining_time () {
+  using enum Slot_State;
+
+  auto &progress = build_progress;
+
+  auto finished = atomic_load(progress.finished_count);
+  auto executed = atomic_load(progress.executed_count);
+
+  auto average = progress.history_average_us;
+  if (!average && executed) average = atomic_load(progress.executed_time_us) / executed;
+
+  const auto now = get_timer_value();
+
+  u64 pending_us = 0;
+  u64 running_us = 0;
+
+  for (auto &slot: progress.slots) {
+    auto state = atomic_load<Memory_Order::Acquire>(slot.state);
+    if (state != Pending && state != Running) continue;
+
+    u64 estimate = slot.estimate_us ? slot.estimate_us : average;
+    if (!estimate) return opt_none;
+
+    if (state == Pending) {
+      pending_us += estimate;
+      continue;
+    }
+
+    auto elapsed = to_micros(now - slot.started_at);
+    if (estimate > elapsed) running_us += estimate - elapsed;
+  }
+
+  /*
+    Up to date files finish without running anything, thus pending tasks are scaled by the share of finished tasks
+    that had to run, otherwise incremental builds would report the time of the full rebuild.
+   */
+  if (finished) pending_us = (pending_us * executed) / finished;
+
+  return (pending_us + running_us) / progress.workers_count;
+}
+
+static String format_duration (Memory_Arena &arena, u64 micros) {
+  if (micros < 1'000'000) return concat_string(arena, micros / 1000, "ms");
+
+  auto seconds = (micros + 999'999) / 1'000'000;
+
+  if (seconds < 60) return concat_string(arena, seconds, "s");
+
+  auto rest = seconds % 60;
+  return concat_string(arena, seconds / 60, "m ", rest < 10 ? "0" : "", rest, "s");
+}
+
+static String format_eta (Memory_Arena &arena) {
+  auto remaining = estimate_remaining_time();
+  if (!remaining.is_some()) return "--";
+
+  return format_duration(arena, remaining.value);
+}
+
+static String get_display_name (String path) {
+  for (usize idx = path.length; idx > 0; idx--) {
+    if (path[idx - 1] == '/' || path[idx - 1] == '\\') return String(path.value + idx, path.length - idx);
+  }
+
+  return path;
+}
+
+static void update_status_line (Memory_Arena &arena) {
+  auto &progress = build_progress;
+
+  u32 running = 0;
+  for (auto &slot: progress.slots) {
+    if (atomic_load(slot.state) == Slot_State::Running) running += 1;
+  }
+
+  String_Builder builder { arena };
+  builder.add(arena, "[", atomic_load(progress.finished_count), "/", progress.tasks_count, "] ",
+              running, " running, ETA ", format_eta(arena));
+
+  const usize width = (progress.terminal_width - 1 < status_line_capacity) ? progress.terminal_width - 1 : status_line_capacity;
+
+  for (u32 idx = 0; idx < progress.slots.count && builder.length < width; idx++) {
+    auto &slot = progress.slots[idx];
+    if (atomic_load<Memory_Order::Acquire>(slot.state) != Slot_State::Running) continue;
+
+    auto name = get_display_name(progress.tasks[idx].name);
+    if (is_link_task(idx)) builder.add(arena, " link:", name);
+    else                   builder.add(arena, " ", name);
+  }
+
+  auto line = build_string(arena, builder);
+
+  progress.status_line_length = (line.length < width) ? line.length : width;
+  copy_memory(progress.status_line, line.value, progress.status_line_length);
+}
+
+static void clear_status_line (Memory_Arena &arena) {
+  auto &progress = build_progress;
+  if (!progress.drawn_length) return;
+
+  auto buffer = reserve<char>(arena, progress.drawn_length + 2);
+  buffer[0] = '\r';
+  for (usize idx = 1; idx <= progress.drawn_length; idx++) buffer[idx] = ' ';
+  buffer[progress.drawn_length + 1] = '\r';
+
+  write_to_stdout(String(buffer, progress.drawn_length + 2));
+  progress.drawn_length = 0;
+}
+
+static void draw_status_line (Memory_Arena &arena) {
+  auto &progress = build_progress;
+
+  clear_status_line(arena);
+
+  write_to_stdout(String(progress.status_line, progress.status_line_length));
+  progress.drawn_length = progress.status_line_length;
+}
+
+/*
+  Log sink for the status mode. Messages are printed in place of the status line, which is drawn again below them.
+ */
+static void write_above_status_line (String message, void *) {
+  auto &progress = build_progress;
+
+  progress.lock.lock();
+
+  Memory_Arena arena { progress.render_region.memory, progress.render_region.size };
+
+  clear_status_line(arena);
+  write_to_stdout(message);
+  draw_status_line(arena);
+
+  progress.lock.unlock();
+}
+
+static void render_status_line_loop (Build_Progress *progress) {
+  while (!atomic_load(progress->stopping)) {
+    thread_sleep(status_refresh_interval);
+
+    progress->lock.lock();
+
+    Memory_Arena arena { progress->render_region.memory, progress->render_region.size };
+
+    update_status_line(arena);
+    draw_status_line(arena);
+
+    progress->lock.unlock();
+  }
+}
+
+static Progress_Mode resolve_progress_mode (Progress_Mode mode, Option<u32> terminal_width) {
+  if (silence_logs_opt) return Progress_Mode::Lines;
+
+  /*
+    Without a terminal there's no way to redraw the line in place.
+   */
+  if (!terminal_width.is_some() || terminal_width.value < 2) {
+    return (mode == Progress_Mode::Lines) ? Progress_Mode::Lines : Progress_Mode::Compact;
+  }
+
+  return (mode == Progress_Mode::Auto) ? Progress_Mode::Status : mode;
+}
+
+void start_build_progress (Memory_Arena &arena, Progress_Mode mode, File_Path history_file_path, Slice<Task_Timing> tasks, u32 first_link_index, u32 workers_count, bool targeted_build) {
+  auto &progress = build_progress;
+
+  fin_ensure(!progress.enabled);
+
+  auto terminal_width = get_stdout_terminal_width();
+
+  progress.enabled            = true;
+  progress.mode               = resolve_progress_mode(mode, terminal_width);
+  progress.frequency          = get_timer_frequency();
+  progress.tasks              = tasks;
+  progress.first_link_index   = first_link_index;
+  progress.workers_count      = workers_count ? workers_count : 1;
+  progress.history_file_path  = history_file_path;
+  progress.targeted_build     = targeted_build;
+  progress.history            = {};
+  progress.history_claimed    = {};
+  progress.history_average_us = 0;
+  progress.status_line_length = 0;
+  progress.drawn_length       = 0;
+
+  atomic_store(progress.finished_count,   0);
+  atomic_store(progress.executed_count,   0);
+  atomic_store(progress.executed_time_us, 0);
+  atomic_store(progress.reported_step,    0);
+  atomic_store(progress.stopping,         0);
+
+  progress.slots = reserve_array<Progress_Slot>(arena, tasks.count);
+  zero_memory(progress.slots.values, progress.slots.count);
+
+  progress.tasks_count = 0;
+  for (usize idx = 0; idx < tasks.count; idx++) {
+    if (is_empty(tasks[idx].name)) continue;
+
+    progress.slots[idx].state.value = Slot_State::Pending;
+    progress.tasks_count += 1;
+  }
+
+  if (!is_empty(history_file_path)) load_history(arena);
+
+  progress.started_at = get_timer_value();
+
+  if (progress.mode != Progress_Mode::Status) return;
+
+  progress.terminal_width = terminal_width.value;
+  progress.render_region  = reserve_virtual_memory(megabytes(1));
+  if (!progress.render_region.memory) panic("Couldn't reserve memory for the build progress\n");
+
+  set_log_sink(write_above_status_line);
+
+  progress.renderer = unwrap(spawn_thread(render_status_line_loop, &progress), "Failed to start the build progress renderer\n");
+}
+
+Progress_Mode get_build_progress_mode () {
+  return build_progress.enabled ? build_progress.mode : Progress_Mode::Lines;
+}
+
+void begin_progress_task (u32 index) {
+  auto &progress = build_progress;
+  if (!progress.enabled) return;
+
+  auto &slot = progress.slots[index];
+  slot.started_at = get_timer_value();
+
+  atomic_store<Memory_Order::Release>(slot.state, Slot_State::Running);
+}
+
+void end_progress_task (u32 index, bool executed) {
+  auto &progress = build_progress;
+  if (!progress.enabled) return;
+
+  auto &slot = progress.slots[index];
+
+  auto duration = to_micros(get_timer_value() - slot.started_at);
+
+  slot.executed    = executed;
+  slot.duration_us = (duration < static_cast<u32>(-1)) ? static_cast<u32>(duration) : static_cast<u32>(-1);
+
+  atomic_store<Memory_Order::Release>(slot.state, Slot_State::Done);
+
+  if (executed) {
+    atomic_fetch_add(progress.executed_count, 1);
+    atomic_fetch_add(progress.executed_time_us, slot.duration_us);
+  }
+
+  auto finished = atomic_fetch_add(progress.finished_count, 1) + 1;
+
+  if (progress.mode != Progress_Mode::Compact || finished == progress.tasks_count) return;
+
+  /*
+    Only the thread that crosses into the next tenth of the build reports it.
+   */
+  auto step     = (finished * 10) / progress.tasks_count;
+  auto reported = atomic_load(progress.reported_step);
+  if (step <= reported || !atomic_compare_and_set(progress.reported_step, reported, step)) return;
+
+  u8 stack_memory[256];
+  Memory_Arena arena { stack_memory };
+
+  log("Progress: % of % tasks finished, ETA %\n", finished, progress.tasks_count, format_eta(arena));
+}
+
+void finish_build_progress (Memory_Arena &arena) {
+  auto &progress = build_progress;
+  if (!progress.enabled) return;
+
+  if (progress.mode == Progress_Mode::Status) {
+    atomic_store(progress.stopping, 1);
+    ensure(wait_for_thread(progress.renderer), "Failed to wait for the build progress renderer to exit\n");
+
+    set_log_sink(nullptr);
+
+    Memory_Arena render_arena { progress.render_region.memory, progress.render_region.size };
+    clear_status_line(render_arena);
+
+    free_virtual_memory(progress.render_region);
+  }
+
+  if (progress.mode != Progress_Mode::Lines) {
+    auto elapsed = to_micros(get_timer_value() - progress.started_at);
+    log("Finished % tasks in %, % of them up to date\n",
+        atomic_load(progress.finished_count), format_duration(arena, elapsed),
+        atomic_load(progress.finished_count) - atomic_load(progress.executed_count));
+  }
+
+  if (!is_empty(progress.history_file_path)) save_history();
+
+  progress.enabled = false;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "anyfin/base.hpp"
+#include "anyfin/arena.hpp"
+#include "anyfin/file_system.hpp"
+#include "anyfin/slice.hpp"
+
+#include "cbuild.hpp"
+#include "build_report.hpp"
+
+enum struct Progress_Mode: u32 {
+  /*
+    Status line if the output is a terminal, compact otherwise.
+   */
+  Auto,
+
+  /*
+    Single line at the bottom of the terminal, redrawn in place, with everything else printed above it.
+   */
+  Status,
+
+  /*
+    Plain line on every tenth of the build's tasks, suitable for CI logs and files.
+   */
+  Compact,
+
+  /*
+    Line for every compiled file and linked target, no progress tracking output.
+   */
+  Lines,
+};
+
+/*
+  Tracks the build's compile, archive and link tasks, showing how many are done, how many are running and the remaining time.
+  The remaining time is estimated from durations of the same tasks from the previous builds, which are saved in the
+  history file once the build is finished, regardless of the mode.
+
+  Tasks are identified by their slots in the build's timings, slots with empty names are not a part of the build. Slots
+  starting from 'first_link_index' belong to link tasks. If the history file path is empty, durations are neither loaded
+  nor saved.
+ */
+void start_build_progress (Memory_Arena &arena, Progress_Mode mode, File_Path history_file_path, Slice<Task_Timing> tasks, u32 first_link_index, u32 workers_count, bool targeted_build);
+
+/*
+  Resolves the mode the progress is rendered in, which tells the builder whether it should log each task itself.
+ */
+Progress_Mode get_build_progress_mode ();
+
+void begin_progress_task (u32 index);
+
+/*
+  Marks the task as done, tasks that didn't run any tool, e.g the file was up to date, are not executed.
+ */
+void end_progress_task (u32 index, bool executed);
+
+/*
+  Removes the status line, prints the summary and saves durations of executed tasks into the history file.
+ */
+void finish_build_progress (Memory_Arena &arena);
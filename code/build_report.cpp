@@ -0,0 +1,398 @@
+
+#include "anyfin/base.hpp"
+#include "anyfin/arena.hpp"
+#include "anyfin/array.hpp"
+#include "anyfin/buffered_writer.hpp"
+#include "anyfin/defer.hpp"
+#include "anyfin/list.hpp"
+#include "anyfin/timers.hpp"
+
+#include "cbuild_api.hpp"
+#include "build_report.hpp"
+#include "json.hpp"
+
+constexpr u32 no_index = static_cast<u32>(-1);
+
+template <typename T>
+static void heap_sort (Array<T> &values, const auto &is_less) {
+  const auto swap_values = [&] (usize left, usize right) {
+    auto temp     = values[left];
+    values[left]  = values[right];
+    values[right] = temp;
+  };
+
+  const auto sift_down = [&] (usize root, usize count) {
+    while (true) {
+      auto child = root * 2 + 1;
+      if (child >= count) return;
+
+      if (child + 1 < count && is_less(values[child], values[child + 1])) child += 1;
+      if (!is_less(values[root], values[child])) return;
+
+      swap_values(root, child);
+      root = child;
+    }
+  };
+
+  for (usize idx = values.count / 2; idx > 0; idx--) sift_down(idx - 1, values.count);
+
+  for (usize end = values.count; end > 1; end--) {
+    swap_values(0, end - 1);
+    sift_down(0, end - 1);
+  }
+}
+
+struct Target_Summary {
+  u32 link_task       = no_index;
+  u32 slowest_file    = no_index;
+  u32 slowest_archive = no_index;
+  u32 files_count     = 0;
+  u64 first_start     = 0;
+  u64 last_end        = 0;
+
+  /*
+    Critical path ending with this target's link task, along with the tasks that precede the link on that path: either
+    one of the target's own files, followed by its archive batch if the target is archived in batches, or the link of an
+    upstream target.
+   */
+  bool path_computed = false;
+  u64  path_length   = 0;
+  u32  path_file     = no_index;
+  u32  path_archive  = no_index;
+  u32  path_upstream = no_index;
+};
+
+struct Timeline_Stats {
+  u64 wall_time;
+  u64 busy_time;
+  u64 serial_time;
+  u32 peak_workers;
+
+  u64        critical_path_length;
+  List<u32>  critical_path; // Task indices, from the first task to the last one
+
+  Array<Target_Summary> targets;
+  Array<u32>            slowest_files;
+  Array<u32>            slowest_targets;
+};
+
+static u64 get_duration (const Task_Timing &task) {
+  return (task.end > task.start) ? task.end - task.start : 0;
+}
+
+static u64 to_micros (u64 frequency, u64 ticks) {
+  return (ticks * 1'000'000) / frequency;
+}
+
+static u64 to_percent (u64 value, u64 total) {
+  return total ? (value * 100) / total : 0;
+}
+
+static u32 find_target_index (const Build_Timeline &timeline, const Target *target) {
+  for (u32 idx = 0; idx < timeline.targets.count; idx++) {
+    if (timeline.targets[idx] == target) return idx;
+  }
+
+  return no_index;
+}
+
+static void summarize_targets (const Build_Timeline &timeline, Array<Target_Summary> &targets) {
+  for (u32 idx = 0; idx < timeline.tasks.count; idx++) {
+    auto &task = timeline.tasks[idx];
+    if (task.kind == Task_Timing::None) continue;
+
+    auto &summary = targets[task.target_index];
+
+    if (task.kind == Task_Timing::Link) summary.link_task = idx;
+    else if (task.kind == Task_Timing::Archive) {
+      if (summary.slowest_archive == no_index || get_duration(task) > get_duration(timeline.tasks[summary.slowest_archive]))
+        summary.slowest_archive = idx;
+    }
+    else {
+      summary.files_count += 1;
+
+      if (summary.slowest_file == no_index || get_duration(task) > get_duration(timeline.tasks[summary.slowest_file]))
+        summary.slowest_file = idx;
+    }
+
+    if (!summary.first_start || task.start < summary.first_start) summary.first_start = task.start;
+    if (task.end > summary.last_end)                              summary.last_end    = task.end;
+  }
+}
+
+/*
+  Files of the same target compile independently, thus the longest path through the target is through its slowest file
+  or its slowest upstream dependency, followed by the target's link. This gives the length of the build, assuming there
+  are enough builders to run everything else in parallel. Batches of a target are archived independently too, the
+  slowest batch is taken to follow the slowest file, even if the file belongs to another batch.
+ */
+static u64 compute_critical_path (const Build_Timeline &timeline, Array<Target_Summary> &targets, u32 target_index) {
+  auto &summary = targets[target_index];
+  if (summary.path_computed) return summary.path_length;
+
+  u64 longest = 0;
+
+  if (summary.slowest_file != no_index) {
+    longest           = get_duration(timeline.tasks[summary.slowest_file]);
+    summary.path_file = summary.slowest_file;
+  }
+
+  if (summary.slowest_archive != no_index) {
+    longest             += get_duration(timeline.tasks[summary.slowest_archive]);
+    summary.path_archive = summary.slowest_archive;
+  }
+
+  for (auto upstream: timeline.targets[target_index]->depends_on) {
+    auto upstream_index = find_target_index(timeline, upstream);
+    if (upstream_index == no_index) continue;
+
+    auto length = compute_critical_path(timeline, targets, upstream_index);
+    if (length > longest) {
+      longest               = length;
+      summary.path_file     = no_index;
+      summary.path_archive  = no_index;
+      summary.path_upstream = upstream_index;
+    }
+  }
+
+  if (summary.link_task != no_index) longest += get_duration(timeline.tasks[summary.link_task]);
+
+  summary.path_computed = true;
+  summary.path_length   = longest;
+
+  return longest;
+}
+
+static Timeline_Stats compute_timeline_stats (Memory_Arena &arena, const Build_Timeline &timeline, u32 top_count) {
+  Timeline_Stats stats {
+    .wall_time     = (timeline.end > timeline.start) ? timeline.end - timeline.start : 0,
+    .critical_path = List<u32>(arena),
+    .targets       = reserve_array<Target_Summary>(arena, timeline.targets.count),
+  };
+
+  for (auto &summary: stats.targets) summary = {};
+
+  summarize_targets(timeline, stats.targets);
+
+  /*
+    Critical path.
+   */
+  u32 last_target = no_index;
+  for (u32 idx = 0; idx < stats.targets.count; idx++) {
+    auto length = compute_critical_path(timeline, stats.targets, idx);
+    if (last_target == no_index || length > stats.critical_path_length) {
+      last_target                = idx;
+      stats.critical_path_length = length;
+    }
+  }
+
+  for (auto target_index = last_target; target_index != no_index;) {
+    auto &summary = stats.targets[target_index];
+
+    if (summary.link_task    != no_index) list_push_front_copy(stats.critical_path, summary.link_task);
+    if (summary.path_archive != no_index) list_push_front_copy(stats.critical_path, summary.path_archive);
+    if (summary.path_file    != no_index) {
+      list_push_front_copy(stats.critical_path, summary.path_file);
+      break;
+    }
+
+    target_index = summary.path_upstream;
+  }
+
+  /*
+    Sweeping through the tasks' start and end points, in order, tells how many builders were busy at any moment. Ends
+    are encoded with the lower bit cleared, thus at the same timestamp these are processed before the starts.
+   */
+  usize recorded_count = 0;
+  for (auto &task: timeline.tasks) if (task.kind != Task_Timing::None) recorded_count += 1;
+
+  auto events = reserve_array<u64>(arena, recorded_count * 2);
+  for (usize offset = 0; auto &task: timeline.tasks) {
+    if (task.kind == Task_Timing::None) continue;
+
+    auto start = (task.start > timeline.start) ? task.start - timeline.start : 0;
+    auto end   = (task.end   > timeline.start) ? task.end   - timeline.start : 0;
+
+    events[offset++] = (start << 1) | 1;
+    events[offset++] = (end   << 1);
+
+    stats.busy_time += get_duration(task);
+  }
+
+  heap_sort(events, [] (u64 left, u64 right) { return left < right; });
+
+  u32 active_count = 0;
+  u64 last_stamp   = 0;
+  for (auto event: events) {
+    auto stamp = event >> 1;
+
+    if (active_count <= 1 && stamp > last_stamp) stats.serial_time += stamp - last_stamp;
+    last_stamp = stamp;
+
+    if (event & 1) {
+      active_count += 1;
+      if (active_count > stats.peak_workers) stats.peak_workers = active_count;
+    }
+    else active_count -= 1;
+  }
+
+  if (stats.wall_time > last_stamp) stats.serial_time += stats.wall_time - last_stamp;
+
+  /*
+    Slowest translation units and targets.
+   */
+  {
+    List<u32> files { arena };
+    for (u32 idx = 0; idx < timeline.tasks.count; idx++) {
+      if (timeline.tasks[idx].kind == Task_Timing::Compile) list_push_copy(files, idx);
+    }
+
+    auto ordered = reserve_array<u32>(arena, files.count);
+    for (usize offset = 0; auto idx: files) ordered[offset++] = idx;
+
+    heap_sort(ordered, [&] (u32 left, u32 right) {
+      return get_duration(timeline.tasks[left]) > get_duration(timeline.tasks[right]);
+    });
+
+    stats.slowest_files = Array(ordered.values, (ordered.count < top_count) ? ordered.count : top_count);
+  }
+
+  {
+    auto ordered = reserve_array<u32>(arena, stats.targets.count);
+    for (u32 idx = 0; idx < ordered.count; idx++) ordered[idx] = idx;
+
+    const auto get_span = [&] (u32 idx) {
+      auto &summary = stats.targets[idx];
+      return (summary.last_end > summary.first_start) ? summary.last_end - summary.first_start : 0;
+    };
+
+    heap_sort(ordered, [&] (u32 left, u32 right) { return get_span(left) > get_span(right); });
+
+    stats.slowest_targets = Array(ordered.values, (ordered.count < top_count) ? ordered.count : top_count);
+  }
+
+  return stats;
+}
+
+static String get_task_kind_name (const Task_Timing &task) {
+  switch (task.kind) {
+    case Task_Timing::Link:    return "link";
+    case Task_Timing::Archive: return "archive";
+    default:                   return "compile";
+  }
+}
+
+static u64 get_target_span (const Target_Summary &summary) {
+  return (summary.last_end > summary.first_start) ? summary.last_end - summary.first_start : 0;
+}
+
+static void print_build_report (const Build_Timeline &timeline, const Timeline_Stats &stats) {
+  const auto frequency = get_timer_frequency();
+  const auto millis    = [&] (u64 ticks) { return to_micros(frequency, ticks) / 1000; };
+
+  log("Build report:\n");
+  log("  Wall time:       %ms\n", millis(stats.wall_time));
+  log("  Critical path:   %ms (% percent of the wall time)\n", millis(stats.critical_path_length), to_percent(stats.critical_path_length, stats.wall_time));
+
+  for (auto idx: stats.critical_path) {
+    auto &task = timeline.tasks[idx];
+    log("    % %: %ms\n", get_task_kind_name(task), task.name, millis(get_duration(task)));
+  }
+
+  log("  Utilization:     % percent on average, peak % of % builders\n",
+      to_percent(stats.busy_time, stats.wall_time * timeline.workers_count), stats.peak_workers, timeline.workers_count);
+  log("  Serial fraction: % percent\n", to_percent(stats.serial_time, stats.wall_time));
+
+  if (stats.slowest_files.count) {
+    log("  Slowest translation units:\n");
+    for (usize rank = 1; auto idx: stats.slowest_files) {
+      auto &task = timeline.tasks[idx];
+      log("    %) % (%): %ms\n", rank++, task.name, timeline.targets[task.target_index]->name, millis(get_duration(task)));
+    }
+  }
+
+  if (stats.slowest_targets.count) {
+    log("  Slowest targets:\n");
+    for (usize rank = 1; auto idx: stats.slowest_targets) {
+      auto &summary = stats.targets[idx];
+      log("    %) %: %ms, % files\n", rank++, timeline.targets[idx]->name, millis(get_target_span(summary)), summary.files_count);
+    }
+  }
+}
+
+static void write_build_report (Memory_Arena &arena, File_Path output_file_path, const Build_Timeline &timeline, const Timeline_Stats &stats) {
+  using enum File_System_Flags;
+
+  const auto frequency = get_timer_frequency();
+  const auto micros    = [&] (u64 ticks) { return to_micros(frequency, ticks); };
+
+  auto file = unwrap(open_file(output_file_path, Write_Access | Always_New), "Couldn't create the build report file");
+  defer { close_file(file); };
+
+  Buffered_Writer writer { arena, kilobytes(64), &file };
+
+  ensure(write(writer, "{\n  \"wall_time_us\": ", micros(stats.wall_time), ",\n"));
+  ensure(write(writer, "  \"critical_path_us\": ", micros(stats.critical_path_length), ",\n"));
+  ensure(write(writer, "  \"builders\": ", timeline.workers_count, ",\n"));
+  ensure(write(writer, "  \"average_utilization_percent\": ", to_percent(stats.busy_time, stats.wall_time * timeline.workers_count), ",\n"));
+  ensure(write(writer, "  \"peak_utilization\": ", stats.peak_workers, ",\n"));
+  ensure(write(writer, "  \"serial_fraction_percent\": ", to_percent(stats.serial_time, stats.wall_time), ",\n"));
+
+  ensure(write(writer, "  \"critical_path\": ["));
+  for (bool first = true; auto idx: stats.critical_path) {
+    auto &task = timeline.tasks[idx];
+
+    ensure(write(writer, first ? "\n" : ",\n", "    {\"kind\": \"", get_task_kind_name(task), "\", \"name\": "));
+    write_json_string(writer, task.name);
+    ensure(write(writer, ", \"thread\": ", task.thread_id, ", \"duration_us\": ", micros(get_duration(task)), "}"));
+
+    first = false;
+  }
+  ensure(write(writer, "\n  ],\n"));
+
+  ensure(write(writer, "  \"slowest_translation_units\": ["));
+  for (bool first = true; auto idx: stats.slowest_files) {
+    auto &task = timeline.tasks[idx];
+
+    ensure(write(writer, first ? "\n" : ",\n", "    {\"name\": "));
+    write_json_string(writer, task.name);
+    ensure(write(writer, ", \"target\": "));
+    write_json_string(writer, timeline.targets[task.target_index]->name);
+    ensure(write(writer, ", \"duration_us\": ", micros(get_duration(task)), "}"));
+
+    first = false;
+  }
+  ensure(write(writer, "\n  ],\n"));
+
+  ensure(write(writer, "  \"slowest_targets\": ["));
+  for (bool first = true; auto idx: stats.slowest_targets) {
+    auto &summary = stats.targets[idx];
+
+    ensure(write(writer, first ? "\n" : ",\n", "    {\"name\": "));
+    write_json_string(writer, timeline.targets[idx]->name);
+    ensure(write(writer, ", \"files\": ", summary.files_count, ", \"duration_us\": ", micros(get_target_span(summary)), "}"));
+
+    first = false;
+  }
+  ensure(write(writer, "\n  ]\n}\n"));
+
+  ensure(flush(writer));
+}
+
+void report_build_timeline (Memory_Arena &arena, const Build_Timeline &timeline, const Build_Report_Options &options) {
+  auto local = arena;
+
+  /*
+    JSON report lists the slowest units even if the printed report wasn't requested.
+   */
+  auto top_count = options.top_count ? options.top_count : 10;
+
+  auto stats = compute_timeline_stats(local, timeline, top_count);
+
+  if (options.top_count) print_build_report(timeline, stats);
+
+  if (!is_empty(options.json_file_path)) {
+    write_build_report(local, options.json_file_path, timeline, stats);
+    log("Build report was written into %\n", options.json_file_path);
+  }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "anyfin/base.hpp"
+#include "anyfin/arena.hpp"
+#include "anyfin/file_system.hpp"
+#include "anyfin/slice.hpp"
+#include "anyfin/strings.hpp"
+
+#include "cbuild.hpp"
+
+struct Target;
+
+struct Build_Report_Options {
+  /*
+    Number of the slowest translation units and targets listed in the report. Zero disables the printed report.
+   */
+  u32 top_count = 0;
+
+  /*
+    If set, the report is also written into this file as JSON.
+   */
+  File_Path json_file_path;
+
+  bool is_enabled () const { return top_count > 0 || !is_empty(json_file_path); }
+};
+
+/*
+  Timings of a single compile, archive or link task, recorded by the builder. Link tasks that were rescheduled while waiting on
+  their dependencies are not recorded, only the one that has processed the target.
+ */
+struct Task_Timing {
+  enum struct Kind: u32 { None, Compile, Archive, Link };
+  using enum Kind;
+
+  Kind kind;
+  u32  target_index;
+  u32  thread_id;
+
+  String name;
+
+  u64 start;
+  u64 end;
+};
+
+struct Build_Timeline {
+  /*
+    Targets built by the builder, Task_Timing::target_index refers into this list.
+   */
+  Slice<const Target *> targets;
+  Slice<Task_Timing>    tasks;
+
+  /*
+    Time window of the task execution phase of the build.
+   */
+  u64 start;
+  u64 end;
+
+  u32 workers_count;
+};
+
+void report_build_timeline (Memory_Arena &arena, const Build_Timeline &timeline, const Build_Report_Options &options);
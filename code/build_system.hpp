@@ -0,0 +1,223 @@
+#pragma once
+
+#include "anyfin/base.hpp"
+#include "anyfin/arena.hpp"
+#include "anyfin/array.hpp"
+#include "anyfin/atomics.hpp"
+#include "anyfin/concurrent.hpp"
+#include "anyfin/file_system.hpp"
+#include "anyfin/memory.hpp"
+#include "anyfin/option.hpp"
+#include "anyfin/threads.hpp"
+
+#include "cbuild.hpp"
+#include "build_trace.hpp"
+
+struct Target_Tracker;
+
+struct Build_Task {
+  enum struct Type: u32 { Uninit, Precompile, Compile, Archive, Link };
+  using enum Type;
+
+  /*
+    REMINDER: The ordering of these fields is important to keep individual tasks separate on cache lines.
+  */
+  Type type;
+  b32  dependencies_updated;
+  Target_Tracker *tracker;
+  File file;
+
+  /*
+    Slot in the build's timings for the compile and precompile tasks.
+   */
+  u32 timing_index;
+
+  /*
+    Batch of the static library's objects for the archive task.
+   */
+  u32 batch_index;
+
+  /*
+    Timestamp of the task's submission into the queue, set only when the build is traced.
+   */
+  u64 submitted_at;
+};
+
+struct Build_System;
+
+/*
+  Executes a single task pulled from the build queue, defined by the builder.
+ */
+void build_target_task (Memory_Arena &arena, Build_System &build_system, Build_Task task);
+
+/*
+  Build queue shared by the main thread and builder threads. It's a bounded MPMC queue, where each slot takes its own cache
+  line, thus builders picking up neighbouring tasks don't contend.
+ */
+struct Build_System {
+  struct Node {
+    Build_Task task;
+    as32 sequence_number;
+
+    char cache_line_pad[CACHE_LINE_SIZE - sizeof(Build_Task) - sizeof(as32)];
+  };
+
+  static_assert(sizeof(Node) == CACHE_LINE_SIZE);
+
+  static constexpr usize RESERVATION_SIZE = megabytes(1);
+
+  Array<Node> queue;
+  cas64 write_index = 0;
+  cas64 read_index  = 0;
+  cau32 submitted   = 0;
+  cau32 completed   = 0;
+
+  Array<Thread> builders {};
+  Semaphore     tasks_available {};
+
+  /*
+    Set once the build is over, signaling builder threads to exit. Matters for long-running processes, like the daemon,
+    that run multiple builds and shouldn't accumulate idle threads.
+   */
+  au32 terminating = 0;
+
+  Build_System (Memory_Arena &arena, const usize queue_size, const usize builders_count)
+    : queue { reserve_array<Node>(arena, align_forward_to_pow_2(queue_size)) }
+  {
+    for (s32 idx = 0; auto &node: this->queue) node.sequence_number = idx++;
+
+    if (builders_count) {
+      tasks_available = unwrap(create_semaphore(), "Failed to create a semaphore resource for the build queue\n");
+      builders        = reserve_array<Thread>(arena, builders_count);
+
+      for (auto &builder: builders) builder = unwrap(spawn_thread(task_system_loop, this)); 
+    }
+  }
+
+  static void task_system_loop (Build_System *system) {
+    auto region = reserve_virtual_memory(RESERVATION_SIZE);
+    Memory_Arena builder_arena { region.memory, region.size };
+
+    set_trace_thread_name("builder");
+
+    while (true) {
+      auto idle_start = begin_trace_span();
+      wait_for_semaphore_signal(system->tasks_available);
+      record_trace_span(idle_start, "idle", "Builder idle");
+
+      if (atomic_load(system->terminating)) break;
+
+      reset_arena(builder_arena);
+      system->execute_task(builder_arena);
+    }
+
+    free_virtual_memory(region);
+  }
+
+  void shutdown (this Build_System &self) {
+    if (self.builders.count == 0) return;
+
+    fin_ensure(!self.has_unfinished_tasks());
+
+    atomic_store(self.terminating, 1);
+    increment_semaphore(self.tasks_available, self.builders.count);
+
+    for (auto &builder: self.builders) ensure(wait_for_thread(builder), "Failed to wait for a builder thread to exit\n");
+
+    destroy(self.tasks_available);
+  }
+
+  void execute_task (this Build_System &self, Memory_Arena &arena) {
+    auto [defined, task] = self.pull_next_task_for_execution();
+    if (!defined) return;
+
+    build_target_task(arena, self, move(task));
+
+    atomic_fetch_add(self.completed, 1);
+  }
+
+  /*
+    Workers, including the main thread, that have nothing to do at the moment, i.e every submitted task that hasn't
+    completed yet, including the one that's asking, is taken as occupying a worker.
+   */
+  u32 get_idle_workers_count (this const Build_System &self) {
+    const auto workers     = static_cast<u32>(self.builders.count + 1);
+    const auto outstanding = atomic_load(self.submitted) - atomic_load(self.completed);
+
+    return (outstanding < workers) ? workers - outstanding : 0;
+  }
+
+  bool has_unfinished_tasks (this const auto &self) {
+    auto completed = atomic_load(self.completed);
+    auto submitted = atomic_load(self.submitted);
+
+    fin_ensure(completed <= submitted);
+
+    return (submitted != completed);
+  }
+
+  Option<Build_Task> pull_next_task_for_execution (this Build_System &self) {
+    using enum Memory_Order;
+  
+    auto index = atomic_load(self.read_index);
+
+    const auto tasks_count = self.queue.count;
+    const auto mask        = tasks_count - 1;
+
+    Node *node = nullptr;
+    while (true) {
+      node = &self.queue[index & mask];
+
+      auto sequence = atomic_load<Acquire>(node->sequence_number);
+      auto diff     = sequence - (index + 1);
+
+      if (diff == 0) {
+        if (atomic_compare_and_set<Relaxed, Relaxed>(self.read_index, index, index + 1)) break;
+      }
+      else if (diff < 0) return {};
+      else index = atomic_load(self.read_index);
+    }
+
+    auto task = move(node->task);
+
+    atomic_store<Release>(node->sequence_number, index + tasks_count);
+
+    return move(task);
+  }
+
+  void submit_task (this Build_System &self, Build_Task &&task) {
+    using enum Memory_Order;
+  
+    auto index = atomic_load(self.write_index);
+
+    const auto tasks_count = self.queue.count;
+    const auto mask        = tasks_count - 1;
+
+    Node *node = nullptr;
+    while (true) {
+      node = &self.queue[index & mask];
+
+      auto sequence = atomic_load<Acquire>(node->sequence_number);
+      auto diff     = sequence - index;
+    
+      if (diff == 0) {
+        if (atomic_compare_and_set(self.write_index, index, index + 1)) break;
+      }
+      else if (diff < 0) continue;
+      else index = atomic_load(self.write_index);
+    }
+
+    /*
+      The submitted count is only checked to see if there are unfinished tasks in the queue or not,
+      so we want to increment it as early as possible.
+    */
+    atomic_fetch_add(self.submitted, 1);
+
+    zero_memory(&node->task);
+    node->task = move(task);
+    node->task.submitted_at = begin_trace_span();
+
+    atomic_store<Release>(node->sequence_number, index + 1);
+    increment_semaphore(self.tasks_available);
+  }
+};
@@ -0,0 +1,209 @@
+
+#include "anyfin/base.hpp"
+#include "anyfin/array.hpp"
+#include "anyfin/atomics.hpp"
+#include "anyfin/buffered_writer.hpp"
+#include "anyfin/memory.hpp"
+#include "anyfin/threads.hpp"
+#include "anyfin/timers.hpp"
+
+#include "build_trace.hpp"
+#include "json.hpp"
+
+extern bool silence_logs_opt;
+
+struct Trace_Event {
+  enum struct Type: u32 { Span, Thread_Name };
+
+  Type type;
+  u32  thread_id;
+
+  u64 start;
+  u64 end;
+
+  const char *category;
+  String      name;
+};
+
+/*
+  Events are appended into a fixed buffer by bumping the atomic counter, thus recording doesn't take any locks. Events
+  past the capacity are dropped and reported when the trace is written.
+
+  Trace starts before the project is loaded, the initial capacity only has to fit the loading phase. Once the project's
+  size is known, the buffer is grown to fit every file's queue, scan and compile spans and every target's spans.
+ */
+constexpr usize trace_events_initial_capacity = 1 << 14;
+constexpr usize trace_events_per_file         = 4;
+constexpr usize trace_events_per_target       = 4;
+constexpr usize trace_events_reserve          = 1024;
+
+static struct {
+  bool enabled;
+
+  u64 frequency;
+  u64 origin;
+
+  Memory_Region      region;
+  Array<Trace_Event> events;
+  au64               events_count;
+  usize              dropped_count;
+} build_trace;
+
+void start_build_trace () {
+  if (build_trace.enabled) return;
+
+  build_trace.region = reserve_virtual_memory(trace_events_initial_capacity * sizeof(Trace_Event));
+  if (!build_trace.region.memory) panic("Couldn't reserve memory for the build trace\n");
+
+  build_trace.events        = Array(reinterpret_cast<Trace_Event *>(build_trace.region.memory), trace_events_initial_capacity);
+  atomic_store(build_trace.events_count, 0);
+  build_trace.dropped_count = 0;
+  build_trace.frequency    = get_timer_frequency();
+  build_trace.origin       = get_timer_value();
+  build_trace.enabled      = true;
+
+  set_trace_thread_name("main");
+}
+
+void fit_build_trace (usize files_count, usize targets_count) {
+  if (!build_trace.enabled) return;
+
+  auto required_capacity = files_count * trace_events_per_file + targets_count * trace_events_per_target + trace_events_reserve;
+  if (required_capacity <= build_trace.events.count) return;
+
+  auto region = reserve_virtual_memory(required_capacity * sizeof(Trace_Event));
+  if (!region.memory) panic("Couldn't reserve memory for the build trace\n");
+
+  /*
+    Events that didn't fit before are already lost, recording continues right after the kept ones.
+   */
+  auto recorded_count = atomic_load(build_trace.events_count);
+  if (recorded_count > build_trace.events.count) {
+    build_trace.dropped_count += recorded_count - build_trace.events.count;
+    recorded_count = build_trace.events.count;
+  }
+
+  auto events = Array(reinterpret_cast<Trace_Event *>(region.memory), required_capacity);
+  copy_memory(events.values, build_trace.events.values, recorded_count);
+
+  free_virtual_memory(build_trace.region);
+
+  build_trace.region = region;
+  build_trace.events = events;
+  atomic_store(build_trace.events_count, recorded_count);
+}
+
+bool is_build_trace_enabled () {
+  return build_trace.enabled;
+}
+
+u64 begin_trace_span () {
+  if (!build_trace.enabled) return 0;
+  return get_timer_value();
+}
+
+static Trace_Event * push_trace_event () {
+  auto index = atomic_fetch_add(build_trace.events_count, 1);
+  if (index >= build_trace.events.count) return nullptr;
+
+  return &build_trace.events[index];
+}
+
+void record_trace_span (u64 start_stamp, u64 end_stamp, const char *category, String name) {
+  if (!build_trace.enabled) return;
+
+  auto event = push_trace_event();
+  if (!event) return;
+
+  *event = Trace_Event {
+    .type      = Trace_Event::Type::Span,
+    .thread_id = get_current_thread_id(),
+    .start     = start_stamp,
+    .end       = end_stamp,
+    .category  = category,
+    .name      = name,
+  };
+}
+
+void record_trace_span (u64 start_stamp, const char *category, String name) {
+  if (!build_trace.enabled) return;
+  record_trace_span(start_stamp, get_timer_value(), category, name);
+}
+
+void set_trace_thread_name (const char *name) {
+  if (!build_trace.enabled) return;
+
+  auto event = push_trace_event();
+  if (!event) return;
+
+  *event = Trace_Event {
+    .type      = Trace_Event::Type::Thread_Name,
+    .thread_id = get_current_thread_id(),
+    .name      = name,
+  };
+}
+
+static u64 to_trace_micros (u64 stamp) {
+  auto elapsed = (stamp > build_trace.origin) ? stamp - build_trace.origin : 0;
+  return (elapsed * 1'000'000) / build_trace.frequency;
+}
+
+void write_build_trace (Memory_Arena &arena, File_Path output_file_path) {
+  using enum File_System_Flags;
+
+  if (!build_trace.enabled) return;
+
+  build_trace.enabled = false;
+
+  auto recorded_count = atomic_load(build_trace.events_count);
+  if (recorded_count > build_trace.events.count) {
+    build_trace.dropped_count += recorded_count - build_trace.events.count;
+    recorded_count = build_trace.events.count;
+  }
+
+  if (build_trace.dropped_count)
+    log("WARNING: Build trace has reached its capacity, % events were dropped\n", build_trace.dropped_count);
+
+  auto local = arena;
+
+  auto file = unwrap(open_file(output_file_path, Write_Access | Always_New), "Couldn't create the build trace file");
+  defer { close_file(file); };
+
+  Buffered_Writer writer { local, kilobytes(64), &file };
+
+  ensure(write(writer, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"));
+
+  for (usize idx = 0; idx < recorded_count; idx++) {
+    auto &event = build_trace.events[idx];
+
+    if (idx) ensure(write(writer, ",\n"));
+
+    switch (event.type) {
+      case Trace_Event::Type::Span: {
+        auto start    = to_trace_micros(event.start);
+        auto duration = to_trace_micros(event.end) - start;
+
+        ensure(write(writer, "{\"ph\":\"X\",\"pid\":1,\"tid\":", event.thread_id, ",\"ts\":", start, ",\"dur\":", duration, ",\"cat\":"));
+        write_json_string(writer, event.category);
+        ensure(write(writer, ",\"name\":"));
+        write_json_string(writer, event.name);
+        ensure(write(writer, '}'));
+        break;
+      }
+      case Trace_Event::Type::Thread_Name: {
+        ensure(write(writer, "{\"ph\":\"M\",\"pid\":1,\"tid\":", event.thread_id, ",\"name\":\"thread_name\",\"args\":{\"name\":"));
+        write_json_string(writer, event.name);
+        ensure(write(writer, "}}"));
+        break;
+      }
+    }
+  }
+
+  ensure(write(writer, "\n]}\n"));
+  ensure(flush(writer));
+
+  free_virtual_memory(build_trace.region);
+  build_trace.events = {};
+
+  if (!silence_logs_opt) log("Build trace was written into %\n", output_file_path);
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "anyfin/base.hpp"
+#include "anyfin/arena.hpp"
+#include "anyfin/file_system.hpp"
+#include "anyfin/strings.hpp"
+
+#include "cbuild.hpp"
+
+/*
+  Records spans of the build's phases, which are written as a Chrome trace-event JSON file that could be opened with
+  chrome://tracing or Perfetto. Until the trace is started, all recording calls are no-ops.
+
+  Names of the spans are not copied, thus these should outlive the trace, e.g string literals, target names and file
+  paths owned by the project.
+ */
+void start_build_trace ();
+
+/*
+  Grows the trace to fit the spans of a build with the given number of files and targets. Must be called while no other
+  thread records into the trace, e.g before builders are started.
+ */
+void fit_build_trace (usize files_count, usize targets_count);
+
+bool is_build_trace_enabled ();
+
+/*
+  Returns the timestamp that marks the beginning of a span, which is later passed to record_trace_span.
+ */
+u64 begin_trace_span ();
+
+void record_trace_span (u64 start_stamp, const char *category, String name);
+void record_trace_span (u64 start_stamp, u64 end_stamp, const char *category, String name);
+
+/*
+  Tags the calling thread in the trace, e.g "main" or "builder".
+ */
+void set_trace_thread_name (const char *name);
+
+/*
+  Writes the recorded spans into the output file and stops the trace.
+ */
+void write_build_trace (Memory_Arena &arena, File_Path output_file_path);
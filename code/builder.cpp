@@ -11,12 +11,22 @@
 #include "anyfin/commands.hpp"
 #include "anyfin/file_system.hpp"
 #include "anyfin/threads.hpp"
+#include "anyfin/timers.hpp"
 #include "anyfin/concurrent.hpp"
+#include "anyfin/defer.hpp"
+#include "anyfin/format.hpp"
+#include "anyfin/hash.hpp"
 
 #include "cbuild_api.hpp"
 #include "scanner.hpp"
 #include "registry.hpp"
 #include "builder.hpp"
+#include "build_progress.hpp"
+#include "build_report.hpp"
+#include "build_system.hpp"
+#include "build_trace.hpp"
+#include "archive.hpp"
+#include "unity_build.hpp"
 
 extern bool tracing_enabled_opt;
 extern bool silence_logs_opt;
@@ -25,14 +35,40 @@ enum struct Target_Compile_Status: u32   { Compiling, Failed, Success };
 enum struct Target_Link_Status: u32      { Waiting, Linking, Failed, Success };
 enum struct Upstream_Targets_Status: u32 { Ignore, Updated, Failed };
 
+/*
+  Objects of large static libraries are archived in batches, each as soon as its last object is compiled, while the rest
+  of the build is still going. The library is then put together from the batches, which is much cheaper than archiving
+  all objects at once, as batches are merged as they are. Batches that haven't changed are reused from the last build.
+
+  Win32 archivers merge input libraries into the output, which is what this relies on.
+ */
+constexpr u32 archive_batch_size = 64;
+
+struct Archive_Batch {
+  as32 pending;
+  au32 compiled;
+};
+
 struct Target_Tracker {
   const Target &target;
 
+  /*
+    Files compiled for the target, these are generated units if the target is built as a unity build.
+   */
+  const List<File_Path> *sources;
+
   Atomic<Target_Compile_Status>   compile_status  { Target_Compile_Status::Compiling };
   Atomic<Target_Link_Status>      link_status     { Target_Link_Status::Waiting };
   Atomic<Upstream_Targets_Status> upstream_status { Upstream_Targets_Status::Ignore };
 
   cau32 skipped_counter    { 0 };
+
+  /*
+    Set if any upstream target was relinked during this build, in which case this target's output is outdated, even if
+    it doesn't get linked because of failures.
+   */
+  au32 upstream_relinked { 0 };
+
   cas32 files_pending      { static_cast<s32>(target.files.count) };
   cas32 waiting_on_counter { static_cast<s32>(target.depends_on.count) };
 
@@ -49,170 +85,288 @@ struct Target_Tracker {
    */
   bool needs_linking { true };
 
+  /*
+    Slot in the build's timings for this target's link task.
+   */
+  u32 link_timing_index { 0 };
+
+  /*
+    Set if the target has a precompiled header and C++ files that use it. These files are held back until the header is
+    built, after which the header's task submits them, marking them as updated if the header was rebuilt. If the header
+    couldn't be built, these files fail without running the compiler.
+
+    INVARIANT:
+      Header's task writes the failure flag before submitting the held tasks, the queue orders this write before any
+      compile task of the target reads it.
+   */
+  bool              precompiled_header        { false };
+  bool              precompiled_header_failed { false };
+  u32               precompile_timing_index   { 0 };
+  Array<Build_Task> held_tasks                {};
+
+  /*
+    Set if the target's objects are archived in batches. The target's compile step finishes with the last batch's
+    archive task, thus 'files_pending' counts these tasks too. Batch of a file is found by its timing slot, batches have
+    their own slots, in the same order.
+   */
+  Array<Archive_Batch> archive_batches          {};
+  u32                  first_file_timing_index  { 0 };
+  u32                  first_batch_timing_index { 0 };
+  au32                 archived_batches_counter { 0 };
+
   Target_Tracker (Target &_target)
-    : target { _target }
+    : target  { _target },
+      sources { &_target.files }
   {
     fin_ensure(_target.build_context.tracker == nullptr);
   }
 };
 
-struct Build_Task {
-  enum struct Type: u32 { Uninit, Compile, Link };
-  using enum Type;
+static File_Path out_folder_path;
+static File_Path object_folder_path;
 
-  /*
-    REMINDER: The ordering of these fields is important to keep individual tasks separate on cache lines.
-  */
-  Type type;
-  b32  dependencies_updated;
-  Target_Tracker *tracker;
-  File file;
-};
+static Registry   registry {};
+static bool       registry_enabled;
+static Update_Set update_set {};
 
-struct Build_System {
-  struct Node {
-    Build_Task task;
-    as32 sequence_number;
+/*
+  Each compile task and each target's link task has its own slot, thus builders record timings without synchronization.
+ */
+static Array<Task_Timing> task_timings {};
+
+/*
+  Null toolchain stands in for the compiler, the linker and the archiver: commands are still prepared, but instead of
+  running them, the builder waits for the configured delay and writes empty outputs. What's left in the build's timings
+  is cbuild's own overhead, i.e the scheduler, the registry and the scanner.
+ */
+static bool null_toolchain_enabled;
+static u32  null_toolchain_delay;
+
+/*
+  Whether each compiled file and linked target gets its own line in the output, otherwise the progress is rendered.
+ */
+static bool task_logs_enabled;
+
+static Sys_Result<System_Command_Status> run_tool_command (Memory_Arena &arena, String command, File_Path output_file_path, File_Path extra_output_file_path = {}) {
+  using enum File_System_Flags;
 
-    char cache_line_pad[CACHE_LINE_SIZE - sizeof(Build_Task) - sizeof(as32)];
-  };
+  if (!null_toolchain_enabled) return run_system_command(arena, command);
 
-  static_assert(sizeof(Node) == CACHE_LINE_SIZE);
+  if (null_toolchain_delay) thread_sleep(null_toolchain_delay);
 
-  static constexpr usize RESERVATION_SIZE = megabytes(1);
+  File_Path outputs [] { output_file_path, extra_output_file_path };
+  for (auto &path: outputs) {
+    if (is_empty(path)) continue;
 
-  Array<Node> queue;
-  cas64 write_index = 0;
-  cas64 read_index  = 0;
-  cau32 submitted   = 0;
-  cau32 completed   = 0;
+    auto [open_error, file] = open_file(path, Write_Access | Always_New);
+    if (open_error) return move(open_error.value);
 
-  Array<Thread> builders {};
-  Semaphore     tasks_available {};
+    fin_check(close_file(file));
+  }
 
-  Build_System (Memory_Arena &arena, const usize queue_size, const usize builders_count)
-    : queue { reserve_array<Node>(arena, align_forward_to_pow_2(queue_size)) }
-  {
-    for (s32 idx = 0; auto &node: this->queue) node.sequence_number = idx++;
+  return System_Command_Status { .status_code = 0 };
+}
+
+/*
+  Commands longer than this pass their arguments through a response file. Windows limits command lines to 32K characters,
+  but tools that re-spawn themselves through the shell are limited to 8K.
+ */
+constexpr usize response_file_threshold = 8000;
+
+/*
+  Builds the command from the builder, which first section is the tool's path. Arguments of long commands, usually links
+  of large targets, are written into the response file and the command only references it. The file is rewritten only
+  if the arguments have changed since the last build.
+ */
+static String make_tool_command (Memory_Arena &arena, const String_Builder &builder, File_Path response_file_path) {
+  using enum File_System_Flags;
 
-    if (builders_count) {
-      tasks_available = unwrap(create_semaphore(), "Failed to create a semaphore resource for the build queue\n");
-      builders        = reserve_array<Thread>(arena, builders_count);
+  const auto command_length = builder.length + builder.sections.count;
+  if (command_length <= response_file_threshold) return build_string_with_separator(arena, builder, ' ');
 
-      for (auto &builder: builders) builder = unwrap(spawn_thread(task_system_loop, this)); 
-    }
+  String         tool_path;
+  String_Builder arguments { arena };
+
+  for (auto &section: builder.sections) {
+    if (!tool_path) tool_path = section;
+    else            arguments += section;
   }
 
-  static void task_system_loop (Build_System *system) {
-    Memory_Arena builder_arena { reserve_virtual_memory(RESERVATION_SIZE) };
+  auto content = build_string_with_separator(arena, arguments, '\n');
+  auto command = concat_string(arena, tool_path, " @\"", response_file_path, "\"");
 
-    while (true) {
-      wait_for_semaphore_signal(system->tasks_available);
+  if (has_same_content(arena, response_file_path, content)) return command;
 
-      reset_arena(builder_arena);
-      system->execute_task(builder_arena);
-    }
+  auto [open_error, file] = open_file(response_file_path, Write_Access | Always_New);
+  if (open_error) {
+    log("WARNING: Couldn't create response file % due to an error: %, passing arguments directly\n", response_file_path, open_error.value);
+    return build_string_with_separator(arena, builder, ' ');
   }
 
-  void execute_task (this Build_System &self, Memory_Arena &arena) {
-    auto [defined, task] = self.pull_next_task_for_execution();
-    if (!defined) return;
+  defer { close_file(file); };
 
-    void build_target_task (Memory_Arena&, Build_System&, Build_Task);
-    build_target_task(arena, self, move(task));
-
-    atomic_fetch_add(self.completed, 1);
+  if (auto result = write_bytes_to_file(file, content); result.is_error()) {
+    log("WARNING: Couldn't write response file % due to an error: %, passing arguments directly\n", response_file_path, result.error.value);
+    return build_string_with_separator(arena, builder, ' ');
   }
 
-  bool has_unfinished_tasks (this const auto &self) {
-    auto completed = atomic_load(self.completed);
-    auto submitted = atomic_load(self.submitted);
+  return command;
+}
 
-    fin_ensure(completed <= submitted);
+static bool is_msvc (Toolchain_Type type) {
+  return ((type == Toolchain_Type_MSVC_X86) ||
+          (type == Toolchain_Type_MSVC_X64) ||
+          (type == Toolchain_Type_LLVM_CL));
+}
 
-    return (submitted != completed);
-  }
+static bool is_msvc (const Toolchain_Configuration &config) {
+  return is_msvc(config.type);
+}
 
-  Option<Build_Task> pull_next_task_for_execution (this Build_System &self) {
-    using enum Memory_Order;
-  
-    auto index = atomic_load(self.read_index);
+/*
+  Outputs of the target's precompiled header, which are placed next to the target's object files and named after the
+  header. MSVC builds the header from a generated source file, which object must be linked into the target, while GCC
+  looks up the '.gch' file next to the included path.
+ */
+struct Precompiled_Header_Paths {
+  File_Path output;
+  File_Path include;
+  File_Path source;
+  File_Path object;
+};
 
-    const auto tasks_count = self.queue.count;
-    const auto mask        = tasks_count - 1;
+static Precompiled_Header_Paths get_precompiled_header_paths (Memory_Arena &arena, const Target &target) {
+  const auto &toolchain = target.project.toolchain;
 
-    Node *node = nullptr;
-    while (true) {
-      node = &self.queue[index & mask];
+  auto header_name = unwrap(get_resource_name(target.precompiled_header));
+  auto base_path   = make_file_path(arena, object_folder_path, target.name, header_name);
+  auto source_path = concat_string(arena, base_path, ".cpp");
 
-      auto sequence = atomic_load<Acquire>(node->sequence_number);
-      auto diff     = sequence - (index + 1);
+  return Precompiled_Header_Paths {
+    .output  = concat_string(arena, base_path, (toolchain.type == Toolchain_Type_GCC) ? ".gch" : ".pch"),
+    .include = base_path,
+    .source  = source_path,
+    .object  = concat_string(arena, source_path, ".", get_object_extension()),
+  };
+}
 
-      if (diff == 0) {
-        if (atomic_compare_and_set<Relaxed, Relaxed>(self.read_index, index, index + 1)) break;
+static void add_include_paths (Memory_Arena &arena, String_Builder &builder, const Target &target, bool msvc) {
+  const List<Include_Path>* include_paths[] { &target.project.include_paths, &target.include_paths };
+  for (auto paths: include_paths) {
+    paths->for_each([&] (auto &path) {
+      switch (path.kind) {
+        case Include_Path::System: {
+          builder += concat_string(arena, msvc ? "/external:I" : "-isystem ", "\"", path.value, "\"");
+          break;
+        }
+        case Include_Path::Local: {
+          builder += concat_string(arena, msvc ? "/I" : "-I ", "\"", path.value, "\"");
+          break;
+        }
       }
-      else if (diff < 0) return {};
-      else index = atomic_load(self.read_index);
-    }
-
-    auto task = move(node->task);
+    });
+  }
+}
 
-    atomic_store<Release>(node->sequence_number, index + tasks_count);
+static String get_linker_path (const Project &project) {
+  return project.selected_linker.path ? project.selected_linker.path : String(project.toolchain.linker_path);
+}
 
-    return move(task);
+static bool is_lld_linker (const Project &project) {
+  switch (project.selected_linker.type) {
+    case Linker_Type_LLD:  return true;
+    case Linker_Type_MSVC: return false;
+    default: return project.toolchain.type == Toolchain_Type_LLVM || project.toolchain.type == Toolchain_Type_LLVM_CL;
   }
+}
 
-  void submit_task (this Build_System &self, Build_Task &&task) {
-    using enum Memory_Order;
-  
-    auto index = atomic_load(self.write_index);
+/*
+  Fast link keeps debug info in object files, the program's database only references it. It's the PDB that must be in
+  place for the target's output to be complete, thus the path is passed to the linker explicitly.
+ */
+static bool uses_fast_link_debug_info (const Target &target) {
+  return is_win32() && target.type != Target::Static_Library && target.debug_info_mode == Debug_Info_Mode_Fast_Link;
+}
 
-    const auto tasks_count = self.queue.count;
-    const auto mask        = tasks_count - 1;
+static File_Path get_debug_info_file_path (Memory_Arena &arena, const Target &target) {
+  return make_file_path(arena, out_folder_path, concat_string(arena, target.name, ".pdb"));
+}
 
-    Node *node = nullptr;
-    while (true) {
-      node = &self.queue[index & mask];
+static bool is_llvm (const Toolchain_Configuration &config) {
+  return config.type == Toolchain_Type_LLVM || config.type == Toolchain_Type_LLVM_CL;
+}
 
-      auto sequence = atomic_load<Acquire>(node->sequence_number);
-      auto diff     = sequence - index;
-    
-      if (diff == 0) {
-        if (atomic_compare_and_set(self.write_index, index, index + 1)) break;
-      }
-      else if (diff < 0) continue;
-      else index = atomic_load(self.write_index);
-    }
+/*
+  Type hashes are used only by LLD, other linkers simply ignore these.
+ */
+static void add_debug_info_options (String_Builder &builder, const Target &target) {
+  const auto &project = target.project;
+  if (uses_fast_link_debug_info(target) && is_llvm(project.toolchain) && is_lld_linker(project)) builder += String("-gcodeview-ghash");
+}
 
-    /*
-      The submitted count is only checked to see if there are unfinished tasks in the queue or not,
-      so we want to increment it as early as possible.
-    */
-    atomic_fetch_add(self.submitted, 1);
+/*
+  ThinLTO cache is shared by project's targets. Entries that weren't used for a week are pruned, as well as the oldest
+  entries once the cache takes more than 10% of the free disk space.
+ */
+constexpr auto lto_cache_policy = "prune_after=168h:cache_size=10%";
+
+static void add_lto_compile_options (String_Builder &builder, const Target &target) {
+  const auto &toolchain = target.project.toolchain;
+  if (!target.lto.enabled) return;
+
+  if      (is_llvm(toolchain))  builder += target.lto.thin ? String("-flto=thin") : String("-flto");
+  else if (is_msvc(toolchain))  builder += String("/GL");
+  else                          builder += String("-flto");
+}
 
-    zero_memory(&node->task);
-    node->task = move(task);
+/*
+  LTO objects are put into static libraries as they are, optimization happens when downstream targets are linked. LLD
+  figures out the kind of LTO from the objects, while MSVC's tools must be told about it.
+ */
+static void add_lto_link_options (Memory_Arena &arena, String_Builder &builder, const Target &target) {
+  const auto &project = target.project;
+  if (!target.lto.enabled) return;
 
-    atomic_store<Release>(node->sequence_number, index + 1);
-    increment_semaphore(self.tasks_available);
+  if (target.type == Target::Static_Library) {
+    if (is_msvc(project.toolchain) && !is_llvm(project.toolchain)) builder += String("/LTCG");
+    return;
   }
-};
 
-static File_Path out_folder_path;
-static File_Path object_folder_path;
+  if (!is_lld_linker(project)) {
+    builder += target.lto.thin ? String("/LTCG:INCREMENTAL") : String("/LTCG");
+    return;
+  }
 
-static Registry   registry {};
-static bool       registry_enabled;
-static Update_Set update_set {};
+  if (target.lto.thin) {
+    auto cache_path = make_file_path(arena, project.build_location_path, "lto_cache");
 
-static bool is_msvc (Toolchain_Type type) {
-  return ((type == Toolchain_Type_MSVC_X86) ||
-          (type == Toolchain_Type_MSVC_X64) ||
-          (type == Toolchain_Type_LLVM_CL));
+    builder += concat_string(arena, is_win32() ? "/lldltocache:\"" : "--thinlto-cache-dir=\"", cache_path, "\"");
+    builder += concat_string(arena, is_win32() ? "/lldltocachepolicy:" : "--thinlto-cache-policy=", lto_cache_policy);
+  }
 }
 
-static bool is_msvc (const Toolchain_Configuration &config) {
-  return is_msvc(config.type);
+/*
+  Thin archives are read by LLVM's linker on Win32 and by all common linkers elsewhere. The archive references objects
+  by their paths, thus it's not produced for targets that are installed somewhere else. On Win32 it's written either by
+  the built-in archiver or by LLVM's archiver, MSVC's archiver ignores the option and writes a regular library.
+ */
+static bool uses_thin_archive (const Target &target) {
+  const auto &project = target.project;
+
+  if (target.type != Target::Static_Library || !target.flags.thin_archive || target.flags.install) return false;
+  if (!is_win32()) return true;
+
+  return is_lld_linker(project) && (project.builtin_archiver || is_llvm(project.toolchain));
+}
+
+static File_Path get_object_file_path (Memory_Arena &arena, const Target &target, File_Path source_path) {
+  auto file_name = concat_string(arena, unwrap(get_resource_name(source_path)), ".", get_object_extension());
+  return make_file_path(arena, object_folder_path, target.name, file_name);
+}
+
+static File_Path get_archive_batch_path (Memory_Arena &arena, const Target &target, u32 batch_index) {
+  auto file_name = format_string(arena, "__batch_%.%", batch_index, get_static_library_extension());
+  return make_file_path(arena, object_folder_path, target.name, file_name);
 }
 
 static void schedule_downstream_linkage (Build_System &build_system, const Target &target, const Invocable<void, Target_Tracker &> auto &update_tracker) {
@@ -261,11 +415,31 @@ static void link_target (Memory_Arena &arena, Build_System &build_system, Target
 
   if (!atomic_compare_and_set(tracker.link_status, TLS::Waiting, TLS::Linking)) return;
 
+  auto &timing = task_timings[tracker.link_timing_index];
+  timing.kind      = Task_Timing::Link;
+  timing.thread_id = thread_id;
+  timing.start     = get_timer_value();
+
+  begin_progress_task(tracker.link_timing_index);
+
   auto upstream_status = atomic_load(tracker.upstream_status);
   if ((target_compilation_status == Target_Compile_Status::Failed) ||
       (upstream_status           == Upstream_Targets_Status::Failed)) {
+    timing.end = get_timer_value();
+    end_progress_task(tracker.link_timing_index, false);
+
     atomic_store(tracker.link_status, TLS::Failed);
 
+    /*
+      Upstream targets relinked by this build won't be relinked by the next one, which therefore wouldn't know that this
+      target must be relinked too. Removing the outdated output makes sure it is.
+     */
+    if (atomic_load(tracker.upstream_relinked)) {
+      auto output_file_path = get_output_file_path_for_target(arena, target);
+      if (auto result = delete_file(output_file_path); result.is_error())
+        log("WARNING: Couldn't remove outdated output % due to an error: %\n", output_file_path, result.error.value);
+    }
+
     schedule_downstream_linkage(build_system, target, [] (Target_Tracker &tracker) {
       atomic_store(tracker.upstream_status, Upstream_Targets_Status::Failed);
     });
@@ -275,15 +449,46 @@ static void link_target (Memory_Arena &arena, Build_System &build_system, Target
 
   auto output_file_path = get_output_file_path_for_target(arena, target);
 
-  enum struct Link_Result { Ignore, Success, Failed };
+  /*
+    Same_Interface is a successful link of a shared library, which exports haven't changed since the last link.
+   */
+  enum struct Link_Result { Ignore, Success, Same_Interface, Failed };
   auto link_result = Link_Result::Ignore;
 
   auto needs_linking = tracker.needs_linking || upstream_status == Upstream_Targets_Status::Updated;
+
+  /*
+    Built-in archiver writes the library straight from the objects, the archiver runs only if some object has a format
+    it doesn't recognize.
+   */
+  const auto use_builtin_archiver = needs_linking && target.type == Target::Static_Library && project.builtin_archiver && !null_toolchain_enabled;
+  if (use_builtin_archiver) {
+    if (task_logs_enabled) log("Linking target: %\n", target.name);
+
+    List<File_Path> objects { arena };
+    for (auto &path: *tracker.sources) list_push(objects, get_object_file_path(arena, target, path));
+
+    if (tracker.precompiled_header && is_msvc(project.toolchain))
+      list_push(objects, get_precompiled_header_paths(arena, target).object);
+
+    auto [error, written] = write_static_archive(arena, output_file_path, objects, uses_thin_archive(target));
+    if (error) {
+      log("WARNING: Target archiving failed due to a system error: %\n", error.value);
+      link_result = Link_Result::Failed;
+    }
+    else if (written) {
+      link_result = Link_Result::Success;
+    }
+    else if (tracing_enabled_opt) {
+      log("Target % has objects the built-in archiver doesn't support, running the archiver\n", target.name);
+    }
+  }
+
   if (!needs_linking) {
     if (tracing_enabled_opt) log("Target '%' linking cancelled, linking is not required\n", target.name);
   }
-  else {
-    if (!silence_logs_opt) log("Linking target: %\n", target.name);
+  else if (link_result == Link_Result::Ignore) {
+    if (task_logs_enabled && !use_builtin_archiver) log("Linking target: %\n", target.name);
 
     auto output_file_name     = concat_string(arena, target.name, ".", get_target_extension(target));
     auto target_object_folder = make_file_path(arena, object_folder_path, target.name);
@@ -300,26 +505,54 @@ static void link_target (Memory_Arena &arena, Build_System &build_system, Target
         builder += String(project.toolchain.archiver_path);
         builder += project.archiver;
         builder += target.archiver;
+        if (uses_thin_archive(target)) builder += is_win32() ? String("/llvmlibthin") : String("--thin");
         break;
       };
       case Target::Shared_Library: {
-        builder += String(project.toolchain.linker_path);
+        builder += get_linker_path(project);
         builder += is_win32() ? String("/dll") : String("-shared");
         builder += project.linker;
         builder += target.linker;
         break;
       };
       case Target::Executable: {
-        builder += String(project.toolchain.linker_path);
+        builder += get_linker_path(project);
         builder += project.linker;
         builder += target.linker;
         break;
       };
     }
 
-    for (auto ext = get_object_extension(); auto &path: target.files) {
-      auto file_name = concat_string(arena, unwrap(get_resource_name(path)), ".", ext);
-      builder += concat_string(arena, "\"", make_file_path(arena, target_object_folder, file_name), "\"");
+    /*
+      Link gets a thread for each worker that's idle right now, on top of its own. Workers picking up tasks later on
+      could overcommit the machine for a while, but links that run alone at the end of the build get all of it.
+     */
+    if (target.type != Target::Static_Library && is_lld_linker(project)) {
+      const auto threads_count = build_system.get_idle_workers_count() + 1;
+      builder += format_string(arena, is_win32() ? "/threads:%" : "--threads=%", threads_count);
+
+      // ThinLTO backends run on their own threads, which are limited separately
+      if (target.lto.enabled && target.lto.thin) builder += format_string(arena, is_win32() ? "/opt:lldltojobs=%" : "--thinlto-jobs=%", threads_count);
+    }
+
+    add_lto_link_options(arena, builder, target);
+
+    if (uses_fast_link_debug_info(target)) {
+      builder += is_lld_linker(project) ? String("/DEBUG:GHASH") : String("/DEBUG:FASTLINK");
+      builder += concat_string(arena, "/PDB:\"", get_debug_info_file_path(arena, target), "\"");
+    }
+
+    if (tracker.archive_batches.count) {
+      for (u32 batch_index = 0; batch_index < tracker.archive_batches.count; batch_index++)
+        builder += concat_string(arena, "\"", get_archive_batch_path(arena, target, batch_index), "\"");
+    }
+    else {
+      for (auto &path: *tracker.sources)
+        builder += concat_string(arena, "\"", get_object_file_path(arena, target, path), "\"");
+    }
+
+    if (tracker.precompiled_header && is_msvc(project.toolchain)) {
+      builder += concat_string(arena, "\"", get_precompiled_header_paths(arena, target).object, "\"");
     }
 
     for (auto upstream_target: target.depends_on) {
@@ -335,30 +568,62 @@ static void link_target (Memory_Arena &arena, Build_System &build_system, Target
     builder += target.link_libraries;
     builder += concat_string(arena, is_win32() ? "/OUT:" : "-o ", output_file_path);
 
-    auto link_command = build_string_with_separator(arena, builder, ' ');
+    auto response_file_path = make_file_path(arena, target_object_folder, concat_string(arena, target.name, ".rsp"));
+    auto link_command       = make_tool_command(arena, builder, response_file_path);
     if (tracing_enabled_opt) log("Linking target % with %\n", target.name, link_command);
 
-    auto [error, status] = run_system_command(arena, link_command);
+    /*
+      On Win32 shared libraries come with the import library, which downstream targets link with.
+     */
+    File_Path import_library_path;
+    if (is_win32() && target.type == Target::Shared_Library)
+      import_library_path = make_file_path(arena, out_folder_path, concat_string(arena, target.name, ".lib"));
+
+    /*
+      Downstream targets don't need to be relinked if the library exports the same symbols, similar to ninja's "restat".
+      Until the link is done, the import library is the one downstream targets were linked with the last time.
+     */
+    Option<u64> previous_interface;
+    if (!is_empty(import_library_path)) previous_interface = get_import_library_interface_hash(import_library_path);
+
+    auto [error, status] = run_tool_command(arena, link_command, output_file_path, null_toolchain_enabled ? import_library_path : File_Path {});
     if (error) {
       log("WARNING: Target linking failed due to a system error: %, command: %\n", error.value, link_command);
       link_result = Link_Result::Failed;
     }
     else if (status.status_code != 0) {
-      log("WARNING: Target linking failed with status: %, command: %\n", status.status_code, link_command);
-      if (status.output) log(concat_string(arena, status.output, "\n"));
+      String_Builder message { arena };
+      message.add(arena, "WARNING: Target linking failed with status: ", status.status_code, ", command: ", link_command, "\n");
+      if (status.output) message.add(arena, status.output, "\n");
+
+      log(build_string(arena, message));
       link_result = Link_Result::Failed;
     }
     else {
       if (status.output) log(concat_string(arena, status.output, "\n"));
       link_result = Link_Result::Success;
+
+      if (previous_interface.is_some()) {
+        auto current_interface = get_import_library_interface_hash(import_library_path);
+        if (current_interface.is_some() && current_interface.value == previous_interface.value) {
+          if (tracing_enabled_opt) log("Exports of target % haven't changed, downstream targets won't be relinked\n", target.name);
+          link_result = Link_Result::Same_Interface;
+        }
+      }
     }
   }
 
   auto target_link_status = (link_result == Link_Result::Failed) ? TLS::Failed : TLS::Success;
+
+  timing.end = get_timer_value();
+  end_progress_task(tracker.link_timing_index, link_result != Link_Result::Ignore);
+
   atomic_store(tracker.link_status, target_link_status);
 
   schedule_downstream_linkage(build_system, target, [link_result] (Target_Tracker &tracker) {
-    if (link_result != Link_Result::Ignore) {
+    if (link_result == Link_Result::Success) atomic_store(tracker.upstream_relinked, 1);
+
+    if (link_result != Link_Result::Ignore && link_result != Link_Result::Same_Interface) {
       auto new_status = Upstream_Targets_Status::Updated;
       if (link_result == Link_Result::Failed) {
         new_status = Upstream_Targets_Status::Failed;
@@ -374,7 +639,55 @@ static void link_target (Memory_Arena &arena, Build_System &build_system, Target
   }
 }
 
-static void compile_file (Memory_Arena &arena, Target_Tracker &tracker, const File &file, const bool dependencies_updated) {
+/*
+  Compile step of the target is either a compiled file or an archived batch. The last step finalizes the target's
+  compilation status and decides whether it should be linked.
+ */
+static void finish_compile_step (Memory_Arena &arena, Target_Tracker &tracker) {
+  const auto &target = tracker.target;
+
+  auto pending = atomic_fetch_sub<Memory_Order::Acquire_Release>(tracker.files_pending, 1);
+  auto was_last_step = (pending - 1) == 0;
+  
+  if (!was_last_step) return;
+
+  /*
+    At this point it's guaranteed that no other thread would modify target's compilation status,
+    since current thread processed the last file or batch.
+  */
+
+  auto compile_status = atomic_load(tracker.compile_status);
+  if (compile_status == Target_Compile_Status::Failed) {
+    log("Target '%' couldn't be linked because of compilation errors\n", target.name);
+    return;
+  }
+
+  auto skipped_count = atomic_load(tracker.skipped_counter);
+  auto needs_linking = (skipped_count < tracker.sources->count) || atomic_load(tracker.archived_batches_counter) > 0;
+  if (!needs_linking) {
+    // If no files were compiled, check that the binary exists, along with its debug info if it's in a separate file
+    File_Path outputs [] {
+      get_output_file_path_for_target(arena, target),
+      uses_fast_link_debug_info(target) ? get_debug_info_file_path(arena, target) : File_Path {},
+    };
+
+    for (auto &path: outputs) {
+      if (is_empty(path)) continue;
+
+      auto [error, exists] = check_file_exists(path);
+      if (error) log("WARNING: Couldn't verify target output file at % due to an error: %\n", path, error.value);
+
+      needs_linking = needs_linking || error || !exists; // force linking in case of a system error check (unlikely) or if doesn't exist
+    }
+  }
+
+  tracker.needs_linking = needs_linking;
+
+  fin_ensure(compile_status == Target_Compile_Status::Compiling);
+  atomic_store<Memory_Order::Release>(tracker.compile_status, Target_Compile_Status::Success);
+}
+
+static void compile_file (Memory_Arena &arena, Build_System &build_system, Target_Tracker &tracker, const File &file, const bool dependencies_updated, u32 timing_index) {
   const auto &target    = tracker.target;
   const auto &project   = target.project;
   const auto &toolchain = project.toolchain;
@@ -385,8 +698,7 @@ static void compile_file (Memory_Arena &arena, Target_Tracker &tracker, const Fi
   auto file_id   = unwrap(get_file_id(file));
   auto timestamp = unwrap(get_last_update_timestamp(file));
 
-  auto target_object_folder = make_file_path(arena, object_folder_path, target.name);
-  auto object_file_path     = make_file_path(arena, target_object_folder, concat_string(arena, unwrap(get_resource_name(file.path)), ".", get_object_extension()));
+  auto object_file_path = get_object_file_path(arena, target, file.path);
 
   bool should_rebuild = true;
 
@@ -421,47 +733,62 @@ static void compile_file (Memory_Arena &arena, Target_Tracker &tracker, const Fi
   enum struct File_Compile_Status { Ignore, Success, Failed };
   auto file_compilation_status = File_Compile_Status::Ignore;
 
-  if (should_rebuild) {
-    if (!silence_logs_opt) log("Building file: %\n", file.path);
+  const auto is_cpp_file = ends_with(file.path, "cpp");
+  const auto uses_precompiled_header = is_cpp_file && tracker.precompiled_header;
+
+  if (should_rebuild && uses_precompiled_header && tracker.precompiled_header_failed) {
+    file_compilation_status = File_Compile_Status::Failed;
+  }
+  else if (should_rebuild) {
+    if (task_logs_enabled) log("Building file: %\n", file.path);
 
-    auto is_cpp_file = ends_with(file.path, "cpp");
-    auto _msvc       = is_msvc(toolchain);
+    auto _msvc = is_msvc(toolchain);
 
     String_Builder builder { arena };
     builder += is_cpp_file ? project.toolchain.cpp_compiler_path : project.toolchain.c_compiler_path;
     builder += project.compiler;
     builder += target.compiler;
 
-    const List<Include_Path>* include_paths[] { &project.include_paths, &target.include_paths };
-    for (auto paths: include_paths) {
-      paths->for_each([&] (auto &path) {
-        switch (path.kind) {
-          case Include_Path::System: {
-            builder += concat_string(arena, _msvc ? "/external:I" : "-isystem ", "\"", path.value, "\"");
-            break;
-          }
-          case Include_Path::Local: {
-            builder += concat_string(arena, _msvc ? "/I" : "-I ", "\"", path.value, "\"");
-            break;
-          }
-        }
-      });
+    add_debug_info_options(builder, target);
+    add_lto_compile_options(builder, target);
+    add_include_paths(arena, builder, target, _msvc);
+
+    if (uses_precompiled_header) {
+      auto paths = get_precompiled_header_paths(arena, target);
+
+      if (_msvc) {
+        builder += concat_string(arena, "/Yu\"", target.precompiled_header, "\"");
+        builder += concat_string(arena, "/FI\"", target.precompiled_header, "\"");
+        builder += concat_string(arena, "/Fp\"", paths.output, "\"");
+      }
+      else if (toolchain.type == Toolchain_Type_GCC) {
+        builder += concat_string(arena, "-include \"", paths.include, "\"");
+      }
+      else {
+        builder += concat_string(arena, "-include-pch \"", paths.output, "\"");
+      }
     }
 
     builder += concat_string(arena, _msvc ? "/c " : "-c ", "\"", file.path, "\"");
     builder += concat_string(arena, _msvc ? "/Fo" : "-o ", "\"", object_file_path, "\"");
 
-    auto compilation_command = build_string_with_separator(arena, builder, ' ');
+    auto compilation_command = make_tool_command(arena, builder, concat_string(arena, object_file_path, ".rsp"));
     if (tracing_enabled_opt) log("Building file % with: %\n", file.path, compilation_command);
 
-    auto [error, status] = run_system_command(arena, compilation_command);
+    auto [error, status] = run_tool_command(arena, compilation_command, object_file_path);
     if (error) {
       log("WARNING: File compilation failed due to a system error: %, command: %\n", error.value, compilation_command);
       file_compilation_status = File_Compile_Status::Failed;
     }
     else if (status.status_code != 0) {
-      log("WARNING: File compilation failed with status: %, command: %\n", status.status_code, compilation_command);
-      if (status.output) log(concat_string(arena, status.output, "\n"));
+      /*
+        Diagnostics of a file are logged as a single message, thus these don't interleave with other builders' output.
+       */
+      String_Builder message { arena };
+      message.add(arena, "WARNING: File compilation failed with status: ", status.status_code, ", command: ", compilation_command, "\n");
+      if (status.output) message.add(arena, status.output, "\n");
+
+      log(build_string(arena, message));
       file_compilation_status = File_Compile_Status::Failed;
     }
     else {
@@ -473,6 +800,8 @@ static void compile_file (Memory_Arena &arena, Target_Tracker &tracker, const Fi
     atomic_fetch_add(tracker.skipped_counter, 1);
   }
 
+  end_progress_task(timing_index, should_rebuild);
+
   if (registry_enabled && file_compilation_status != File_Compile_Status::Failed) {
     auto index = atomic_fetch_add(target_info->files_count, 1);
     fin_ensure(index < target_info->aligned_max_files_count);
@@ -488,54 +817,298 @@ static void compile_file (Memory_Arena &arena, Target_Tracker &tracker, const Fi
     atomic_store(tracker.compile_status, Target_Compile_Status::Failed);
   }
 
-  auto pending = atomic_fetch_sub<Memory_Order::Acquire_Release>(tracker.files_pending, 1);
-  auto was_last_target_file = (pending - 1) == 0;
-  
-  if (!was_last_target_file) return;
+  if (tracker.archive_batches.count) {
+    const auto batch_index = (timing_index - tracker.first_file_timing_index) / archive_batch_size;
+    auto &batch = tracker.archive_batches[batch_index];
+
+    if (file_compilation_status == File_Compile_Status::Success) atomic_store(batch.compiled, 1);
+
+    if ((atomic_fetch_sub<Memory_Order::Acquire_Release>(batch.pending, 1) - 1) == 0) {
+      build_system.submit_task(Build_Task {
+        .type        = Build_Task::Archive,
+        .tracker     = &tracker,
+        .batch_index = batch_index,
+      });
+    }
+  }
+
+  finish_compile_step(arena, tracker);
+}
+
+/*
+  Batch is archived again if any of its objects was compiled, if its members have changed since the last build, e.g
+  files were added or removed, or if the batch's library is missing. Members are recorded next to the library once it's
+  archived, a failed batch has none, thus it's archived again by the next build.
+ */
+static void archive_batch (Memory_Arena &arena, Target_Tracker &tracker, u32 batch_index, u32 timing_index) {
+  using enum File_System_Flags;
+
+  const auto &target  = tracker.target;
+  const auto &project = target.project;
+
+  auto &batch = tracker.archive_batches[batch_index];
 
   /*
-    At this point it's guaranteed that no other thread would modify target's compilation status,
-    since current thread processed the last file.
-  */
+    Target with compilation errors won't be linked, archiving its objects is a waste of time.
+   */
+  if (atomic_load(tracker.compile_status) == Target_Compile_Status::Failed) {
+    end_progress_task(timing_index, false);
+    return finish_compile_step(arena, tracker);
+  }
 
-  auto compile_status = atomic_load(tracker.compile_status);
-  if (compile_status == Target_Compile_Status::Failed) {
-    log("Target '%' couldn't be linked because of compilation errors\n", target.name);
-    return;
+  auto batch_path   = get_archive_batch_path(arena, target, batch_index);
+  auto members_path = concat_string(arena, batch_path, ".members");
+
+  const auto first_member = batch_index * archive_batch_size;
+  const auto last_member  = first_member + archive_batch_size;
+
+  String_Builder members { arena };
+  for (u32 idx = 0; auto &path: *tracker.sources) {
+    const auto member_index = idx++;
+    if (member_index < first_member || member_index >= last_member) continue;
+
+    members += concat_string(arena, "\"", get_object_file_path(arena, target, path), "\"");
   }
 
-  auto skipped_count = atomic_load(tracker.skipped_counter);
-  auto needs_linking = skipped_count < target.files.count;
-  if (!needs_linking) {
-    // If no files were compiled, check that the binary exists
-    auto output_file_path = get_output_file_path_for_target(arena, target);
+  auto members_content = build_string_with_separator(arena, members, '\n');
 
-    auto [error, exists] = check_file_exists(output_file_path);
-    if (error) log("WARNING: Couldn't verify target output file at % due to an error: %\n", file.path, error.value);
+  bool should_archive = atomic_load(batch.compiled) || !has_same_content(arena, members_path, members_content);
+  if (!should_archive) {
+    auto [error, exists] = check_file_exists(batch_path);
+    should_archive = error || !exists;
+  }
+
+  if (!should_archive) {
+    if (tracing_enabled_opt) log("No changes in batch % of target %, skipping archiving\n", batch_index, target.name);
 
-    needs_linking = error || !exists; // force linking in case of a system error check (unlikely) or if doesn't exist
+    end_progress_task(timing_index, false);
+    return finish_compile_step(arena, tracker);
   }
 
-  tracker.needs_linking = needs_linking;
+  String_Builder builder { arena };
+  builder += String(project.toolchain.archiver_path);
+  builder += project.archiver;
+  builder += target.archiver;
 
-  fin_ensure(compile_status == Target_Compile_Status::Compiling);
-  atomic_store<Memory_Order::Release>(tracker.compile_status, Target_Compile_Status::Success);
+  add_lto_link_options(arena, builder, target);
+
+  builder += members.sections;
+  builder += concat_string(arena, "/OUT:\"", batch_path, "\"");
+
+  auto command = make_tool_command(arena, builder, concat_string(arena, batch_path, ".rsp"));
+  if (tracing_enabled_opt) log("Archiving batch % of target % with: %\n", batch_index, target.name, command);
+
+  /*
+    Members are dropped upfront, if archiving is interrupted the batch is archived again by the next build.
+   */
+  if (auto result = delete_file(members_path); result.is_error())
+    log("WARNING: Couldn't remove batch members file % due to an error: %\n", members_path, result.error.value);
+
+  bool archived = false;
+
+  auto [error, status] = run_tool_command(arena, command, batch_path);
+  if (error) {
+    log("WARNING: Batch archiving failed due to a system error: %, command: %\n", error.value, command);
+  }
+  else if (status.status_code != 0) {
+    String_Builder message { arena };
+    message.add(arena, "WARNING: Batch archiving failed with status: ", status.status_code, ", command: ", command, "\n");
+    if (status.output) message.add(arena, status.output, "\n");
+
+    log(build_string(arena, message));
+  }
+  else {
+    if (status.output) log(concat_string(arena, status.output, "\n"));
+    archived = true;
+  }
+
+  if (archived) {
+    atomic_fetch_add(tracker.archived_batches_counter, 1);
+
+    auto [open_error, file] = open_file(members_path, Write_Access | Always_New);
+    if (open_error) {
+      log("WARNING: Couldn't create batch members file % due to an error: %\n", members_path, open_error.value);
+    }
+    else {
+      if (auto result = write_bytes_to_file(file, members_content); result.is_error())
+        log("WARNING: Couldn't write batch members file % due to an error: %\n", members_path, result.error.value);
+
+      close_file(file);
+    }
+  }
+  else {
+    atomic_store(tracker.compile_status, Target_Compile_Status::Failed);
+  }
+
+  end_progress_task(timing_index, true);
+
+  finish_compile_step(arena, tracker);
+}
+
+/*
+  The header is rebuilt if it or its includes have changed, which the scanner reports with 'dependencies_updated', or
+  if any of its outputs is missing. Returns true if the header was rebuilt, even if that has failed.
+ */
+static bool precompile_header (Memory_Arena &arena, Target_Tracker &tracker, const File &header, const bool dependencies_updated, u32 timing_index) {
+  using enum File_System_Flags;
+
+  const auto &target    = tracker.target;
+  const auto &project   = target.project;
+  const auto &toolchain = project.toolchain;
+
+  const auto _msvc = is_msvc(toolchain);
+
+  auto paths = get_precompiled_header_paths(arena, target);
+
+  bool should_rebuild = project.rebuild_required || dependencies_updated;
+  if (!should_rebuild) {
+    File_Path outputs [] { paths.output, _msvc ? paths.object : File_Path {} };
+    for (auto &path: outputs) {
+      if (is_empty(path)) continue;
+
+      auto [error, exists] = check_file_exists(path);
+      should_rebuild = should_rebuild || error || !exists;
+    }
+  }
+
+  if (!should_rebuild) {
+    if (tracing_enabled_opt) log("No changes in precompiled header %, skipping compilation\n", header.path);
+
+    end_progress_task(timing_index, false);
+    return false;
+  }
+
+  if (task_logs_enabled) log("Precompiling header: %\n", header.path);
+
+  String_Builder builder { arena };
+  builder += toolchain.cpp_compiler_path;
+  builder += project.compiler;
+  builder += target.compiler;
+
+  add_debug_info_options(builder, target);
+  add_lto_compile_options(builder, target);
+  add_include_paths(arena, builder, target, _msvc);
+
+  if (_msvc) {
+    /*
+      MSVC precompiles everything up to the named header in a regular source file, which is generated here.
+     */
+    auto source_content = concat_string(arena, "#include \"", target.precompiled_header, "\"\n");
+
+    auto [open_error, source] = open_file(paths.source, Write_Access | Always_New);
+    if (open_error) panic("Couldn't create precompiled header source % due to an error: %\n", paths.source, open_error.value);
+
+    ensure(write_bytes_to_file(source, source_content));
+    close_file(source);
+
+    builder += concat_string(arena, "/c /Yc\"", target.precompiled_header, "\"");
+    builder += concat_string(arena, "/Fp\"", paths.output, "\"");
+    builder += concat_string(arena, "/Fo\"", paths.object, "\"");
+    builder += concat_string(arena, "\"", paths.source, "\"");
+  }
+  else {
+    builder += concat_string(arena, "-x c++-header \"", target.precompiled_header, "\"");
+    builder += concat_string(arena, "-o \"", paths.output, "\"");
+  }
+
+  auto command = make_tool_command(arena, builder, concat_string(arena, paths.output, ".rsp"));
+  if (tracing_enabled_opt) log("Precompiling header % with: %\n", header.path, command);
+
+  auto [error, status] = run_tool_command(arena, command, paths.output, _msvc ? paths.object : File_Path {});
+  if (error) {
+    log("WARNING: Header precompilation failed due to a system error: %, command: %\n", error.value, command);
+    tracker.precompiled_header_failed = true;
+  }
+  else if (status.status_code != 0) {
+    String_Builder message { arena };
+    message.add(arena, "WARNING: Header precompilation failed with status: ", status.status_code, ", command: ", command, "\n");
+    if (status.output) message.add(arena, status.output, "\n");
+
+    log(build_string(arena, message));
+    tracker.precompiled_header_failed = true;
+  }
+  else if (status.output) {
+    log(concat_string(arena, status.output, "\n"));
+  }
+
+  end_progress_task(timing_index, true);
+
+  return true;
 }
 
-static void build_target_task (Memory_Arena &arena, Build_System &build_system, Build_Task task) {
+void build_target_task (Memory_Arena &arena, Build_System &build_system, Build_Task task) {
   const u32 thread_id = get_current_thread_id();
 
   auto &tracker = *task.tracker;
   auto &target  = tracker.target;
 
+  if (task.type != Build_Task::Type::Uninit)
+    record_trace_span(task.submitted_at, "queue", (task.type == Build_Task::Link || task.type == Build_Task::Archive) ? target.name : task.file.path);
+
   switch (task.type) {
     case Build_Task::Type::Uninit: return;
+    case Build_Task::Type::Precompile: {
+      if (tracing_enabled_opt)
+        log("TRACE(#%): Picking up precompiled header % for target %\n", thread_id, task.file.path, target.name);
+
+      auto &timing = task_timings[task.timing_index];
+      timing.kind      = Task_Timing::Compile;
+      timing.thread_id = thread_id;
+      timing.start     = get_timer_value();
+
+      begin_progress_task(task.timing_index);
+      auto header_rebuilt = precompile_header(arena, tracker, task.file, task.dependencies_updated, task.timing_index);
+
+      timing.end = get_timer_value();
+      record_trace_span(timing.start, timing.end, "compile", task.file.path);
+
+      for (auto held_task: tracker.held_tasks) {
+        held_task.dependencies_updated = held_task.dependencies_updated || header_rebuilt;
+        build_system.submit_task(move(held_task));
+      }
+
+      break;
+    }
     case Build_Task::Type::Compile: {
       if (tracing_enabled_opt)
         log("TRACE(#%): Picking up file % for target % for compilation\n",
               thread_id, task.file.path, target.name);
 
-      compile_file(arena, tracker, task.file, task.dependencies_updated);
+      auto &timing = task_timings[task.timing_index];
+      timing.kind      = Task_Timing::Compile;
+      timing.thread_id = thread_id;
+      timing.start     = get_timer_value();
+
+      begin_progress_task(task.timing_index);
+      compile_file(arena, build_system, tracker, task.file, task.dependencies_updated, task.timing_index);
+
+      timing.end = get_timer_value();
+      record_trace_span(timing.start, timing.end, "compile", task.file.path);
+
+      auto status = atomic_load(tracker.compile_status);
+      if (status == Target_Compile_Status::Compiling) break;
+
+      task.type = Build_Task::Link;
+      build_system.submit_task(move(task));
+
+      break;
+    }
+    case Build_Task::Type::Archive: {
+      if (tracing_enabled_opt)
+        log("TRACE(#%): Picking up batch % of target % for archiving\n", thread_id, task.batch_index, target.name);
+
+      const auto timing_index = tracker.first_batch_timing_index + task.batch_index;
+
+      auto &timing = task_timings[timing_index];
+      timing.kind      = Task_Timing::Archive;
+      timing.thread_id = thread_id;
+      timing.start     = get_timer_value();
+
+      begin_progress_task(timing_index);
+      archive_batch(arena, tracker, task.batch_index, timing_index);
+
+      timing.end = get_timer_value();
+      record_trace_span(timing.start, timing.end, "archive", timing.name);
 
       auto status = atomic_load(tracker.compile_status);
       if (status == Target_Compile_Status::Compiling) break;
@@ -549,7 +1122,10 @@ static void build_target_task (Memory_Arena &arena, Build_System &build_system,
       if (tracing_enabled_opt)
         log("TRACE(#%): Picking up target % for linkage\n", thread_id, target.name);
 
+      auto link_start = begin_trace_span();
       link_target(arena, build_system, tracker);
+      record_trace_span(link_start, "link", target.name);
+
       break;
     }
   }
@@ -565,7 +1141,10 @@ static u32 number_of_extra_builders_to_spawn (u32 builders_count) {
 }
 
 static auto create_task_system (Memory_Arena &arena, const Project &project, u32 builders_count) {
-  const auto queue_size = project.targets.count + project.total_files_count;
+  /*
+    Each target could have a link task, a precompiled header's task and archive tasks of its batches at the same time.
+   */
+  const auto queue_size = 3 * project.targets.count + project.total_files_count + project.total_files_count / archive_batch_size;
   return Build_System(arena, queue_size, number_of_extra_builders_to_spawn(builders_count));
 }
 
@@ -626,56 +1205,208 @@ static Build_Plan prepare_build_plan (Memory_Arena &arena, const Project &projec
 
 static void validate_toolchain (const Project &project) {
   const auto &tc = project.toolchain;
+  const auto linker_path = get_linker_path(project);
 
   if (!tc.c_compiler_path)   panic("C compiler path is not set for the project\n");
   if (!tc.cpp_compiler_path) panic("C++ compiler path is not set for the project\n");
-  if (!tc.linker_path)       panic("Linker path is not set for the project\n");
+  if (!linker_path)          panic("Linker path is not set for the project\n");
   if (!tc.archiver_path)     panic("Archive tool is not set for the project\n");
 
   if (!check_file_exists(tc.c_compiler_path).or_default(false))   panic("No C compiler found at %\n", tc.c_compiler_path);
   if (!check_file_exists(tc.cpp_compiler_path).or_default(false)) panic("No C++ compiler found at %\n", tc.cpp_compiler_path);
-  if (!check_file_exists(tc.linker_path).or_default(false))       panic("No linker found at %\n", tc.linker_path);
+  if (!check_file_exists(linker_path).or_default(false))          panic("No linker found at %\n", linker_path);
   if (!check_file_exists(tc.archiver_path).or_default(false))     panic("No archive tool found at %\n", tc.archiver_path);
+
+  /*
+    Clang's LTO objects are LLVM bitcode, which only LLVM's linker can read.
+   */
+  if (is_llvm(tc) && !is_lld_linker(project)) {
+    for (auto &target: project.targets) {
+      if (target.lto.enabled) panic("Target '%' uses LTO, which with the LLVM toolchain requires LLVM's linker, MSVC's linker can't read LLVM bitcode\n", target.name);
+    }
+  }
 }
 
+/*
+  Objects produced for the target's sources are listed in the target's manifest. Once the target is built, objects from
+  the previous manifest that aren't produced anymore, e.g the source was excluded from the target or removed, are deleted
+  along with their response files, thus the object folder doesn't keep every file that has ever been in the target.
+  Archive batches are listed too, batches past the current count are deleted along with their members files.
+ */
+static void collect_stale_objects (Memory_Arena &arena, const Target_Tracker &tracker) {
+  using enum File_System_Flags;
+
+  const auto &target = tracker.target;
+
+  auto manifest_path = make_file_path(arena, object_folder_path, target.name, "__objects");
+
+  String_Builder objects { arena };
+  for (auto &path: *tracker.sources) objects += get_object_file_path(arena, target, path);
+
+  for (u32 batch_index = 0; batch_index < tracker.archive_batches.count; batch_index++)
+    objects += get_archive_batch_path(arena, target, batch_index);
+
+  auto content = build_string_with_separator(arena, objects, '\n');
+  if (has_same_content(arena, manifest_path, content)) return;
+
+  /*
+    Set of the current objects' hashes, a collision only keeps a stale object around.
+   */
+  auto table = reserve_array<u64>(arena, align_forward_to_pow_2(objects.sections.count * 2 + 2));
+  zero_memory(table.values, table.count);
+
+  for (auto &path: objects.sections) {
+    auto key = make_table_key(hash_string(path));
+    table[find_table_slot(table, key)] = key;
+  }
+
+  if (auto [open_error, file] = open_file(manifest_path); !open_error) {
+    defer { close_file(file); };
+
+    if (auto [read_error, previous] = get_file_content(arena, file); !read_error) {
+      split_string(String(reinterpret_cast<const char *>(previous.values), previous.count), '\n').for_each([&] (String path) {
+        auto key = make_table_key(hash_string(path));
+        if (table[find_table_slot(table, key)] == key) return;
+
+        auto local = arena;
+
+        auto object_path = copy_string(local, path);
+        if (tracing_enabled_opt) log("Removing stale object %\n", object_path);
+
+        if (auto result = delete_file(object_path); result.is_error())
+          log("WARNING: Couldn't remove stale object % due to an error: %\n", object_path, result.error.value);
+
+        delete_file(concat_string(local, object_path, ".rsp"));
+        delete_file(concat_string(local, object_path, ".members"));
+      });
+    }
+  }
+
+  auto [open_error, file] = open_file(manifest_path, Write_Access | Always_New);
+  if (open_error) {
+    log("WARNING: Couldn't create objects manifest % due to an error: %\n", manifest_path, open_error.value);
+    return;
+  }
+
+  defer { close_file(file); };
+
+  if (auto result = write_bytes_to_file(file, content); result.is_error())
+    log("WARNING: Couldn't write objects manifest % due to an error: %\n", manifest_path, result.error.value);
+}
+
+/*
+  Size and update time of a file, which tell whether the installed file is the same as the target's output.
+ */
+struct File_Stamp {
+  u64 size;
+  u64 timestamp;
+
+  bool operator == (const File_Stamp &other) const = default;
+};
+
+static Option<File_Stamp> get_file_stamp (File_Path path) {
+  auto [open_error, file] = open_file(path);
+  if (open_error) return opt_none;
+
+  defer { close_file(file); };
+
+  auto [size_error, size] = get_file_size(file);
+  if (size_error) return opt_none;
+
+  auto [timestamp_error, timestamp] = get_last_update_timestamp(file);
+  if (timestamp_error) return opt_none;
+
+  return File_Stamp { .size = size, .timestamp = timestamp };
+}
+
+/*
+  Executables and shared libraries are copied into the install location, since the linker may update its output in
+  place, which would go through a hard link into the installed file, and it can't write an output that shares the file
+  with a running installed program. Static libraries are only read by downstream links, these are hard linked, which
+  is only a metadata update, and copied if that's not possible, e.g the location is on a different volume. Both keep
+  the output's update time, thus targets that weren't relinked since the last install are skipped.
+ */
 static void install_targets (Memory_Arena &arena, const List<Target_Tracker> &trackers) {
   bool check = false;
   for (auto &t: trackers) check = check || t.target.flags.install;
 
   if (check == false) return; // No targets marked for installation
 
-  log("Installing targets:\n");
+  bool header_logged = false;
 
-  for (auto tracker: trackers) {
+  for (auto &tracker: trackers) {
     auto &target  = tracker.target;
     auto &project = target.project;
-    
-    if (target.flags.install) {
-      auto output_file_path = get_output_file_path_for_target(arena, target);
 
-      auto install_path = target.install_location_overwrite;
-      if (!install_path) {
-        if (target.type == Target::Static_Library)
-          install_path = project.library_install_location_path;
-        else 
-          install_path = project.binary_install_location_path;
-      }
+    if (!target.flags.install) continue;
+
+    if (atomic_load(tracker.link_status) != Target_Link_Status::Success) {
+      log("WARNING: Target '%' wasn't built successfully and won't be installed\n", target.name);
+      continue;
+    }
+
+    auto output_file_path = get_output_file_path_for_target(arena, target);
+
+    auto install_path = target.install_location_overwrite;
+    if (!install_path) {
+      if (target.type == Target::Static_Library)
+        install_path = project.library_install_location_path;
+      else 
+        install_path = project.binary_install_location_path;
+    }
+
+    fin_ensure(install_path);
+
+    auto installed_file_path = make_file_path(arena, install_path, unwrap(get_resource_name(output_file_path)));
+
+    auto output_stamp = get_file_stamp(output_file_path);
+    if (output_stamp.is_none()) {
+      log("WARNING: Couldn't install target '%', output file % couldn't be accessed\n", target.name, output_file_path);
+      continue;
+    }
 
-      fin_ensure(install_path);
-    
-      log("  Target '%': % -> %\n", target.name, output_file_path, install_path);
+    auto installed_stamp = get_file_stamp(installed_file_path);
+    if (installed_stamp.is_some() && installed_stamp.value == output_stamp.value) {
+      if (tracing_enabled_opt) log("Installed target '%' is up to date\n", target.name);
+      continue;
+    }
+
+    if (!header_logged) {
+      log("Installing targets:\n");
+      header_logged = true;
+    }
 
-      copy_file(output_file_path, install_path);
+    log("  Target '%': % -> %\n", target.name, output_file_path, install_path);
+
+    if (auto result = create_directory(install_path, File_System_Flags::Force); result.is_error()) {
+      log("WARNING: Couldn't create install location % due to an error: %\n", install_path, result.error.value);
+      continue;
     }
+
+    /*
+      The installed file could be a hard link to the previous output, which must be replaced rather than overwritten.
+     */
+    if (auto result = delete_file(installed_file_path); result.is_error()) {
+      log("WARNING: Couldn't replace installed file % due to an error: %\n", installed_file_path, result.error.value);
+      continue;
+    }
+
+    if (target.type == Target::Static_Library && create_hard_link(installed_file_path, output_file_path).is_ok()) continue;
+
+    if (auto result = copy_file(output_file_path, installed_file_path); result.is_error())
+      log("WARNING: Couldn't install target '%' due to an error: %\n", target.name, result.error.value);
   }
 }
 
-u32 build_project (Memory_Arena &arena, const Project &project, const List<String> &selected_targets, Cache_Behavior cache, u32 builders_count) {
+u32 build_project (Memory_Arena &arena, const Project &project, const List<String> &selected_targets, Cache_Behavior cache, u32 builders_count, const Build_Report_Options &report_options, Option<u32> null_toolchain, Progress_Mode progress_mode) {
   using enum File_System_Flags;
 
   const bool is_targeted_build = !is_empty(selected_targets);
 
-  validate_toolchain(project);
+  null_toolchain_enabled = null_toolchain.is_some();
+  null_toolchain_delay   = null_toolchain.is_some() ? null_toolchain.value : 0;
+
+  if (!null_toolchain_enabled) validate_toolchain(project);
 
   if (is_empty(project.targets)) return 0;
 
@@ -697,14 +1428,127 @@ u32 build_project (Memory_Arena &arena, const Project &project, const List<Strin
     update_set = init_update_set(arena, project, registry, is_targeted_build); 
   }
 
+  fit_build_trace(project.total_files_count, project.targets.count);
+
   auto task_system = create_task_system(arena, project, builders_count);
   auto build_plan  = prepare_build_plan(arena, project, selected_targets);
 
+  prepare_scan_cache(project.total_files_count);
+
   Chain_Scanner scanner(arena, registry, update_set);
 
   List<Include_Path> project_include_paths { arena };
   for (auto &path: project.include_paths) list_push_copy(project_include_paths, path);
 
+  /*
+    Units never outnumber the target's files, thus everything sized by the project's files count still fits.
+   */
+  List<List<File_Path>> unity_sources { arena };
+
+  for (auto &tracker: build_plan.selected_targets) {
+    const auto &target = tracker.target;
+    if (target.unity.files_per_unit < 2 || target.files.count == 0) continue;
+
+    auto &units = list_push(unity_sources, List<File_Path>(arena));
+    prepare_unity_units(arena, target, units);
+
+    tracker.sources = &units;
+    atomic_store(tracker.files_pending, static_cast<s32>(units.count));
+  }
+
+  /*
+    Timings are laid out as compile tasks, followed by precompiled headers' tasks, archive batches' tasks and link tasks.
+    Precompiled headers and links have a slot per selected target. Every batch but the last one of its target is full,
+    thus batches never need more slots than a batch per target on top of the project's files split into batches.
+   */
+  const u32 targets_count     = build_plan.selected_targets.count;
+  const u32 first_batch_index = project.total_files_count + targets_count;
+  const u32 first_link_index  = first_batch_index + project.total_files_count / archive_batch_size + targets_count;
+
+  task_timings = reserve_array<Task_Timing>(arena, first_link_index + targets_count);
+  zero_memory(task_timings.values, task_timings.count);
+
+  /*
+    Timing slots are assigned upfront, thus the progress knows about all tasks of the build before any of them starts.
+   */
+  u32 tracker_index      = 0;
+  u32 file_timing_index  = 0;
+  u32 batch_timing_index = first_batch_index;
+
+  for (auto &tracker: build_plan.selected_targets) {
+    const auto &target       = tracker.target;
+    const auto  target_index = tracker_index++;
+
+    tracker.precompile_timing_index = project.total_files_count + target_index;
+    tracker.link_timing_index       = first_link_index + target_index;
+    if (target.files.count == 0) continue;
+
+    task_timings[tracker.link_timing_index] = Task_Timing { .target_index = target_index, .name = target.name };
+
+    tracker.first_file_timing_index = file_timing_index;
+
+    const auto sources_count = static_cast<u32>(tracker.sources->count);
+    /*
+      Thin archives don't copy objects, there's nothing to gain from batches.
+     */
+    const auto archive_in_batches = is_win32() && target.type == Target::Static_Library && !project.builtin_archiver && !uses_thin_archive(target);
+    if (archive_in_batches && sources_count > archive_batch_size) {
+      const auto batches_count = (sources_count + archive_batch_size - 1) / archive_batch_size;
+
+      tracker.archive_batches          = reserve_array<Archive_Batch>(arena, batches_count);
+      tracker.first_batch_timing_index = batch_timing_index;
+
+      for (u32 idx = 0; idx < batches_count; idx++) {
+        const auto remaining = sources_count - idx * archive_batch_size;
+
+        auto &batch = tracker.archive_batches[idx];
+        atomic_store(batch.pending, static_cast<s32>((remaining < archive_batch_size) ? remaining : archive_batch_size));
+        atomic_store(batch.compiled, 0);
+
+        task_timings[batch_timing_index++] = Task_Timing {
+          .target_index = target_index,
+          .name         = format_string(arena, "% batch %", target.name, idx),
+        };
+      }
+
+      atomic_store(tracker.files_pending, static_cast<s32>(sources_count + batches_count));
+    }
+
+    /*
+      Precompiled header is built only if some C++ files are going to use it.
+     */
+    if (target.precompiled_header) {
+      u32 cpp_files_count = 0;
+      for (auto &path: *tracker.sources) if (ends_with(path, "cpp")) cpp_files_count += 1;
+
+      if (cpp_files_count) {
+        tracker.precompiled_header = true;
+        tracker.held_tasks         = reserve_array<Build_Task>(arena, cpp_files_count);
+
+        task_timings[tracker.precompile_timing_index] = Task_Timing { .target_index = target_index, .name = target.precompiled_header };
+      }
+    }
+
+    for (const auto &file_path: *tracker.sources) {
+      task_timings[file_timing_index++] = Task_Timing { .target_index = target_index, .name = file_path };
+    }
+  }
+
+  /*
+    Null toolchain's timings have nothing to do with the real tools, these shouldn't affect estimates of real builds.
+   */
+  File_Path timings_file_path;
+  if (!null_toolchain_enabled) timings_file_path = make_file_path(arena, project.build_location_path, "__timings");
+
+  start_build_progress(arena, progress_mode, timings_file_path, Slice(task_timings.values, task_timings.count),
+                       first_link_index, task_system.builders.count + 1, is_targeted_build);
+
+  task_logs_enabled = !silence_logs_opt && get_build_progress_mode() == Progress_Mode::Lines;
+
+  file_timing_index = 0;
+
+  const auto build_start = get_timer_value();
+
   for (auto &tracker: build_plan.selected_targets) {
     const auto &target = tracker.target;
 
@@ -715,7 +1559,9 @@ u32 build_project (Memory_Arena &arena, const Project &project, const List<Strin
 
     ensure(create_directory(make_file_path(arena, object_folder_path, target.name)));
 
-    for (const auto &file_path: target.files) {
+    u32 held_count = 0;
+
+    for (const auto &file_path: *tracker.sources) {
       Build_Task task {
         .type = Build_Task::Compile,
         /*
@@ -727,6 +1573,7 @@ u32 build_project (Memory_Arena &arena, const Project &project, const List<Strin
         .dependencies_updated = !registry_enabled,
         .tracker = &tracker,
         .file    = unwrap(open_file(file_path)),
+        .timing_index = file_timing_index++,
       };
 
       if (registry_enabled) {
@@ -735,11 +1582,44 @@ u32 build_project (Memory_Arena &arena, const Project &project, const List<Strin
         List<Include_Path> include_paths(local, project_include_paths);
         for (auto &path: target.include_paths) list_push_front_copy(include_paths, path);
 
+        auto scan_start = begin_trace_span();
         task.dependencies_updated = scan_dependency_chain(local, scanner, include_paths, task.file);
+        record_trace_span(scan_start, "scan", file_path);
+      }
+
+      if (tracker.precompiled_header && ends_with(file_path, "cpp")) {
+        tracker.held_tasks[held_count++] = task;
+        continue;
       }
 
       task_system.submit_task(move(task));
     }
+
+    if (tracker.precompiled_header) {
+      fin_ensure(held_count == tracker.held_tasks.count);
+
+      Build_Task task {
+        .type = Build_Task::Precompile,
+        .dependencies_updated = !registry_enabled,
+        .tracker = &tracker,
+        .file    = unwrap(open_file(target.precompiled_header)),
+        .timing_index = tracker.precompile_timing_index,
+      };
+
+      if (registry_enabled) {
+        auto local = arena;
+
+        List<Include_Path> include_paths(local, project_include_paths);
+        for (auto &path: target.include_paths) list_push_front_copy(include_paths, path);
+
+        task.dependencies_updated = scan_header_chain(local, scanner, include_paths, task.file);
+      }
+
+      /*
+        Held tasks are complete at this point, the header's task is the only one reading them from now on.
+       */
+      task_system.submit_task(move(task));
+    }
   }
 
   /*
@@ -761,7 +1641,17 @@ u32 build_project (Memory_Arena &arena, const Project &project, const List<Strin
   auto main_thread_local_context = make_sub_arena(arena, Build_System::RESERVATION_SIZE);
   while (task_system.has_unfinished_tasks()) task_system.execute_task(main_thread_local_context);
 
-  if (registry_enabled) flush_registry(registry, update_set);
+  const auto build_end = get_timer_value();
+
+  task_system.shutdown();
+
+  finish_build_progress(arena);
+
+  if (registry_enabled) {
+    auto flush_start = begin_trace_span();
+    flush_registry(registry, update_set);
+    record_trace_span(flush_start, "registry", "Registry flush");
+  }
 
   u32 exit_code = 0;
   for (auto tracker: build_plan.selected_targets) {
@@ -775,7 +1665,41 @@ u32 build_project (Memory_Arena &arena, const Project &project, const List<Strin
     }
   }
 
-  install_targets(arena, build_plan.selected_targets);
+  if (report_options.is_enabled()) {
+    auto targets = reserve_array<const Target *>(arena, build_plan.selected_targets.count);
+    for (usize idx = 0; auto &tracker: build_plan.selected_targets) targets[idx++] = &tracker.target;
+
+    report_build_timeline(arena, Build_Timeline {
+      .targets       = Slice(targets.values, targets.count),
+      .tasks         = Slice(task_timings.values, task_timings.count),
+      .start         = build_start,
+      .end           = build_end,
+      .workers_count = static_cast<u32>(task_system.builders.count + 1),
+    }, report_options);
+  }
+
+  /*
+    Targets that failed keep their objects, these could be still needed once the errors are fixed.
+   */
+  for (auto &tracker: build_plan.selected_targets) {
+    if (tracker.target.files.count == 0) continue;
+
+    if ((tracker.compile_status.value == Target_Compile_Status::Success) &&
+        (tracker.link_status.value    == Target_Link_Status::Success)) {
+      auto local = arena;
+      collect_stale_objects(local, tracker);
+    }
+  }
+
+  /*
+    Outputs of the null toolchain are empty placeholders, these must not end up in the install location.
+   */
+  if (!null_toolchain_enabled) install_targets(arena, build_plan.selected_targets);
+
+  /*
+    Build context points into this build's memory, it must not leak into the next build of the same project.
+   */
+  for (auto &target: project.targets) target.build_context = {};
 
   return exit_code;
 }
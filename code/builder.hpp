@@ -3,8 +3,11 @@
 
 #include "anyfin/base.hpp"
 #include "anyfin/arena.hpp"
+#include "anyfin/option.hpp"
 
 #include "cbuild.hpp"
+#include "build_progress.hpp"
+#include "build_report.hpp"
 
 struct Project;
 struct Build_Command;
@@ -40,4 +43,20 @@ u32 build_project (
   /*
     How many builders to spawn for concurrent builds.
    */
-  u32 builders_count);
+  u32 builders_count,
+
+  /*
+    Controls the report on the build's critical path and parallelism, which is produced once all tasks are finished.
+   */
+  const Build_Report_Options &report_options = {},
+
+  /*
+    If set, tools aren't invoked, instead each compile and link step waits for the given number of milliseconds and
+    writes an empty output file. Used to measure the build system's own overhead.
+   */
+  Option<u32> null_toolchain = opt_none,
+
+  /*
+    How the build's progress is shown, see Progress_Mode.
+   */
+  Progress_Mode progress_mode = Progress_Mode::Auto);
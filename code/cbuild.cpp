@@ -10,10 +10,23 @@
 #include "cbuild.hpp"
 #include "workspace.hpp"
 #include "builder.hpp"
+#include "build_trace.hpp"
+#include "daemon.hpp"
+#include "registry_command.hpp"
+#include "scanner.hpp"
+#include "watch.hpp"
 
 #include "anyfin/c_runtime_compat.hpp"
 
-Panic_Handler panic_handler = terminate;
+/*
+  Logs are written in the background, these must be out before the process exits.
+ */
+[[noreturn]] static void flush_logs_and_terminate (u32 exit_code) {
+  flush_logs();
+  terminate(exit_code);
+}
+
+Panic_Handler panic_handler = flush_logs_and_terminate;
 
 bool silence_logs_opt    = false;
 bool tracing_enabled_opt = false;
@@ -24,6 +37,9 @@ enum struct CLI_Command {
   Init,
   Build,
   Clean,
+  Registry,
+  Daemon,
+  Watch,
   Update,
   Version,
   Help,
@@ -64,6 +80,10 @@ struct Build_Command {
   List<String> selected_targets;
   Cache_Behavior cache = Cache_Behavior::On;
   u32 builders_count   = static_cast<u32>(-1);
+  File_Path trace_file_path;
+  Build_Report_Options report;
+  Option<u32> null_toolchain;
+  Progress_Mode progress = Progress_Mode::Auto;
 
   constexpr Build_Command (Memory_Arena &arena)
     : selected_targets { arena } {}
@@ -98,6 +118,53 @@ struct Build_Command {
       });
     };
 
+    auto [trace_defined, trace] = find_argument_value(command_arguments, "trace");
+    if (trace_defined) {
+      if (is_empty(trace)) panic("Invalid value for the 'trace' option, expected a path to the output file");
+      command.trace_file_path = trace;
+    };
+
+    auto [report_defined, report] = find_argument_value(command_arguments, "report");
+    if (report_defined) {
+      if (is_empty(report)) panic("Invalid value for the 'report' option, expected the number of entries to list");
+
+      u32 count = 0;
+      for (auto digit: report) {
+        if (digit < '0' || digit > '9') panic("Invalid value for the 'report' option, expected a positive number");
+        count = (count * 10) + (digit - '0');
+      }
+
+      if (count == 0) panic("Invalid value for the 'report' option, this value cannot be '0'");
+
+      command.report.top_count = count;
+    };
+
+    auto [report_json_defined, report_json] = find_argument_value(command_arguments, "report_json");
+    if (report_json_defined) {
+      if (is_empty(report_json)) panic("Invalid value for the 'report_json' option, expected a path to the output file");
+      command.report.json_file_path = report_json;
+    };
+
+    auto [null_toolchain_defined, null_toolchain] = find_argument_value(command_arguments, "null_toolchain");
+    if (null_toolchain_defined) {
+      u32 delay = 0;
+      for (auto digit: null_toolchain) {
+        if (digit < '0' || digit > '9') panic("Invalid value for the 'null_toolchain' option, expected a delay in milliseconds\n");
+        delay = (delay * 10) + (digit - '0');
+      }
+
+      command.null_toolchain = delay;
+    };
+
+    auto [progress_defined, progress] = find_argument_value(command_arguments, "progress");
+    if (progress_defined) {
+      if      (progress == "auto")    command.progress = Progress_Mode::Auto;
+      else if (progress == "status")  command.progress = Progress_Mode::Status;
+      else if (progress == "compact") command.progress = Progress_Mode::Compact;
+      else if (progress == "lines")   command.progress = Progress_Mode::Lines;
+      else panic("Invalid value % for the 'progress' option, expected one of: auto, status, compact, lines", progress);
+    };
+
     return command;
   }
 };
@@ -131,6 +198,41 @@ struct Clean_Command {
   }
 };
 
+struct Registry_Command {
+  Registry_Command_Mode mode = Registry_Command_Mode::Stats;
+
+  String    target;
+  File_Path registry_path;
+
+  static Registry_Command parse (Memory_Arena &arena, const Slice<Startup_Argument> &command_arguments) {
+    Registry_Command command;
+
+    if (!is_empty(command_arguments) && (*command_arguments).is_value()) {
+      auto mode = (*command_arguments).key;
+
+      if      (mode == "stats")   command.mode = Registry_Command_Mode::Stats;
+      else if (mode == "dump")    command.mode = Registry_Command_Mode::Dump;
+      else if (mode == "verify")  command.mode = Registry_Command_Mode::Verify;
+      else if (mode == "compact") command.mode = Registry_Command_Mode::Compact;
+      else panic("ERROR: Unrecognized registry command mode: '%'\n", mode);
+    }
+
+    auto [target_defined, target] = find_argument_value(command_arguments, "target");
+    if (target_defined) {
+      if (command.mode != Registry_Command_Mode::Dump) panic("ERROR: The 'target' option is supported only by the 'dump' mode\n");
+      command.target = target;
+    }
+
+    auto [path_defined, path] = find_argument_value(command_arguments, "path");
+    if (path_defined) {
+      if (command.mode == Registry_Command_Mode::Compact) panic("ERROR: Registry compaction requires project's configuration and doesn't support the 'path' option\n");
+      command.registry_path = make_file_path(arena, path);
+    }
+
+    return command;
+  }
+};
+
 static constexpr String help_message =
   R"help(
 Usage: cbuild [options] <command> [command_args]
@@ -170,6 +272,31 @@ Commands:
                     upstream dependencies) only. Multiple targets name be specied, separated by ",", e.g:
                       cbuild build targets=bin1,bin2
 
+    trace=<FILE>    Records the timeline of the build and writes it into the FILE in Chrome's trace event format, which
+                    could be opened in chrome://tracing or Perfetto. Covers project loading, toolchain discovery, every
+                    scanned, compiled and linked file, registry flush, tasks' queue wait and builders' idle time.
+
+    report=<NUM>    Prints a report on the build's parallelism once it's finished: the critical path through compile and
+                    link tasks, average and peak utilization of builders, the fraction of time when at most one task
+                    was running, and NUM slowest translation units and targets.
+
+    report_json=<FILE>
+                    Writes the same report into the FILE as JSON, listing 10 slowest units, unless 'report' is set.
+
+    null_toolchain=<MILLIS>
+                    Doesn't invoke the compiler, the linker or the archiver. Instead, each step waits for MILLIS
+                    milliseconds and writes an empty output file, which is useful to measure cbuild's own overhead.
+                    Targets are not installed. Outputs are placeholders, written into a separate folder, thus the
+                    real build's outputs and its cache are left intact.
+
+    progress=<MODE> Specifies how the build's progress is shown. ETA is estimated from the durations of the same tasks in
+                    previous builds. <MODE> parameter can take one of the following arguments:
+                      "auto":    Status line if the output is a terminal, compact otherwise. Default behavior
+                      "status":  Status line at the bottom of the terminal with the number of finished tasks, running
+                                 files and ETA. Output of the tools is printed above it.
+                      "compact": Line on every tenth of finished tasks, without a line per file.
+                      "lines":   Line for every compiled file and linked target.
+
     <others>        You can pass arbitrary arguments to the 'build' command. These arguments are accessible in your
                     project's configuration, via the tool's api defined in the generated ./project/cbuild.h.
 
@@ -183,6 +310,36 @@ Commands:
 
     all            Removes everything under .cbuild folder.
 
+  registry [stats | dump | verify | compact]
+    Inspects and maintains the project's registry, the cache file where CBuild keeps information about previously built
+    files and their dependencies.
+
+    stats          Prints a summary of the registry's content. Default mode.
+
+    dump           Prints every record in the registry.
+                     target=<NAME>  Limits the output to the files of the specified target.
+
+    verify         Checks the registry for structural problems, exits with a non-zero code if any were found.
+
+    compact        Drops records of targets and included files that are no longer part of the project, e.g stale
+                   dependency records left behind by targeted builds.
+
+    path=<FILE>    Inspect the registry file at the specified path, instead of the current project's registry.
+                   Not supported by the 'compact' mode.
+
+  daemon [stop]
+    Starts a long-running process that keeps the project's configuration loaded, serving subsequent 'build' commands
+    for this project without reloading it. While the daemon is running, 'build' sends its request to the daemon, unless
+    it was started with different arguments. The daemon stops if the project's configuration changes.
+
+    <others>       Arguments for the project's configuration, same as the ones passed to the 'build' command.
+
+    stop           Stops the daemon running for the current project.
+
+  watch
+    Builds the project and keeps watching the project's sources for changes, rebuilding the project when those occur.
+    Accepts the same arguments as the 'build' command. Stops if the project's configuration changes.
+
   update
     Updates the tool's API header files within your current project configuration folder (i.e ./project) to match the latest
     version of the tool.
@@ -304,23 +461,90 @@ static CLI_Command parse_command (Slice<Startup_Argument> &args) {
   if (!arg.is_value()) {
     log("Command name is expected as the first argument, a %=% pair is found instead\n", arg.key, arg.value);
     log(help_message);
-    terminate(1);
+    flush_logs_and_terminate(1);
   }
 
   args += 1;
 
   const auto command_name = arg.key;
 
-  if (command_name == "init")    return CLI_Command::Init;
-  if (command_name == "build")   return CLI_Command::Build;
-  if (command_name == "clean")   return CLI_Command::Clean;
-  if (command_name == "update")  return CLI_Command::Update;
-  if (command_name == "version") return CLI_Command::Version;
-  if (command_name == "help")    return CLI_Command::Help;
+  if (command_name == "init")     return CLI_Command::Init;
+  if (command_name == "build")    return CLI_Command::Build;
+  if (command_name == "clean")    return CLI_Command::Clean;
+  if (command_name == "registry") return CLI_Command::Registry;
+  if (command_name == "daemon")   return CLI_Command::Daemon;
+  if (command_name == "watch")    return CLI_Command::Watch;
+  if (command_name == "update")   return CLI_Command::Update;
+  if (command_name == "version")  return CLI_Command::Version;
+  if (command_name == "help")     return CLI_Command::Help;
 
   return CLI_Command::Dynamic;
 }
 
+/*
+  Null toolchain leaves placeholders in place of the build's outputs, which must never be taken for real ones, thus
+  such builds get their own folder, along with their own registry.
+ */
+static u32 run_project_build (Memory_Arena &arena, Project &project, const Build_Command &command) {
+  if (command.null_toolchain.is_none())
+    return build_project(arena, project, command.selected_targets, command.cache, command.builders_count, command.report, command.null_toolchain, command.progress);
+
+  auto build_location_path = project.build_location_path;
+  project.build_location_path = make_file_path(arena, build_location_path, "__null_toolchain");
+
+  auto exit_code = build_project(arena, project, command.selected_targets, command.cache, command.builders_count, command.report, command.null_toolchain, command.progress);
+
+  project.build_location_path = build_location_path;
+
+  return exit_code;
+}
+
+static u32 serve_daemon_build_request (Memory_Arena &arena, Slice<Startup_Argument> args, void *context) {
+  auto &project = *static_cast<Project *>(context);
+
+  auto command = Build_Command::parse(arena, args);
+
+  /*
+    Daemon's output goes to the client through the pipe, there's no terminal to draw the status line in.
+   */
+  if (command.progress != Progress_Mode::Lines) command.progress = Progress_Mode::Compact;
+
+  if (!is_empty(command.trace_file_path)) start_build_trace();
+
+  auto exit_code = run_project_build(arena, project, command);
+
+  if (!is_empty(command.trace_file_path)) write_build_trace(arena, command.trace_file_path);
+
+  /*
+    Loading a new configuration forces the first build to rebuild everything, subsequent builds reuse the same
+    configuration, same as if the project was loaded by a new process.
+   */
+  project.rebuild_required = false;
+
+  return exit_code;
+}
+
+struct Watch_Context {
+  Project       &project;
+  Build_Command &command;
+};
+
+static u32 run_watch_build (Memory_Arena &arena, void *context) {
+  auto &[project, command] = *static_cast<Watch_Context *>(context);
+
+  /*
+    Each rebuild overwrites the trace file, leaving the timeline of the latest build.
+   */
+  if (!is_empty(command.trace_file_path)) start_build_trace();
+
+  auto exit_code = run_project_build(arena, project, command);
+  project.rebuild_required = false;
+
+  if (!is_empty(command.trace_file_path)) write_build_trace(arena, command.trace_file_path);
+
+  return exit_code;
+}
+
 static bool ensure_relative_path (const File_Path &path) {
   return path[0] != '/' && (path.length >= 2 && path[1] != ':');
 }
@@ -336,6 +560,8 @@ u32 run_cbuild () {
   // TODO: #perf check what's the impact from page faults is. How would large pages affect?
   Memory_Arena arena { reserve_virtual_memory(megabytes(64)) };
 
+  start_log_writer();
+
   find_executable(arena, "cbuild");
     
   auto args        = get_startup_args(arena);
@@ -398,6 +624,16 @@ u32 run_cbuild () {
     return 0;
   }
 
+  /*
+    Registry file could be inspected directly, without loading the project's configuration.
+   */
+  Registry_Command registry_command {};
+  if (command_type == CLI_Command::Registry) {
+    registry_command = Registry_Command::parse(arena, args_cursor);
+    if (registry_command.registry_path)
+      return inspect_registry(arena, registry_command.registry_path, registry_command.mode, registry_command.target);
+  }
+
   auto cache_dir = make_file_path(arena, working_directory_path, ".cbuild");
 
   /*
@@ -408,12 +644,66 @@ u32 run_cbuild () {
    */
   auto project_output_dir = resolve_project_output_dir_name(arena, working_directory_path);
 
+  auto daemon_pipe_name = get_daemon_pipe_name(arena, working_directory_path, project_output_dir);
+
+  if (command_type == CLI_Command::Build) {
+    /*
+      Arguments are validated locally, a running daemon would have to reject invalid ones anyway.
+     */
+    auto command = Build_Command::parse(arena, args_cursor);
+
+    auto [served, exit_code] = send_daemon_request(arena, daemon_pipe_name, Daemon_Request_Type::Build, args_cursor);
+    if (served) return exit_code;
+
+    /*
+      Tracing starts before the project is loaded, to capture configuration and toolchain discovery costs.
+     */
+    if (!is_empty(command.trace_file_path)) start_build_trace();
+  }
+
+  if (command_type == CLI_Command::Daemon && !is_empty(args_cursor) && (*args_cursor).is_value() && (*args_cursor).key == "stop") {
+    auto [served, exit_code] = send_daemon_request(arena, daemon_pipe_name, Daemon_Request_Type::Stop, {});
+    if (!served) {
+      log("No running daemon found for the project\n");
+      return 1;
+    }
+
+    return exit_code;
+  }
+
   Project project { arena, "project", working_directory_path, cache_dir, project_output_dir };
   load_project(arena, project, args_cursor);
 
   if (command_type == CLI_Command::Build) {
-    auto [targets, cache, builders_count] = Build_Command::parse(arena, args_cursor);
-    return build_project(arena, project, targets, cache, builders_count);
+    auto command   = Build_Command::parse(arena, args_cursor);
+    auto exit_code = run_project_build(arena, project, command);
+
+    if (!is_empty(command.trace_file_path)) write_build_trace(arena, command.trace_file_path);
+
+    return exit_code;
+  }
+
+  if (command_type == CLI_Command::Watch) {
+    auto command = Build_Command::parse(arena, args_cursor);
+
+    Watch_Context context { project, command };
+
+    enable_scan_cache();
+    return run_watch(arena, project, run_watch_build, &context);
+  }
+
+  if (command_type == CLI_Command::Daemon) {
+    enable_scan_cache();
+    return run_daemon(arena, daemon_pipe_name, args_cursor, serve_daemon_build_request, &project);
+  }
+
+  if (command_type == CLI_Command::Registry) {
+    auto registry_file_path = make_file_path(arena, project.build_location_path, "__registry");
+
+    if (registry_command.mode == Registry_Command_Mode::Compact)
+      return compact_registry(arena, project, registry_file_path);
+
+    return inspect_registry(arena, registry_file_path, registry_command.mode, registry_command.target);
   }
 
   fin_ensure(command_type == CLI_Command::Dynamic);
@@ -433,6 +723,6 @@ u32 run_cbuild () {
 }
 
 int mainCRTStartup () {
-  terminate(run_cbuild());
+  flush_logs_and_terminate(run_cbuild());
 }
 
@@ -19,6 +19,24 @@ using namespace Fin;
 
 void log (String message);
 
+/*
+  By default logs are written into the stdout. Log sink reroutes them elsewhere, e.g the daemon sends the output of a
+  build back to the client that requested it. Passing nullptr restores the default behavior.
+ */
+using Log_Sink = void (*) (String message, void *context);
+void set_log_sink (Log_Sink sink, void *context = nullptr);
+
+/*
+  Moves writing of logs to a background thread, log calls only copy the message into a shared buffer. Until it's
+  started, logs are written by the calling thread.
+ */
+void start_log_writer ();
+
+/*
+  Blocks until all messages logged so far are written, e.g before the process exits.
+ */
+void flush_logs ();
+
 typedef void (*Panic_Handler) (u32 exit_code);
 extern Panic_Handler panic_handler;
 
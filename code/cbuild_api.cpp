@@ -546,3 +546,87 @@ CBUILD_EXPERIMENTAL_API int run_system_command (Project *project, const char *co
 
   return status.status_code;
 }
+
+CBUILD_EXPERIMENTAL_API void enable_unity_build (Target *target, unsigned int files_per_unit) CBUILD_NO_EXCEPT {
+  require_non_null(target);
+
+  target->unity.files_per_unit = files_per_unit;
+}
+
+CBUILD_EXPERIMENTAL_API void set_precompiled_header (Target *target, const char *header) CBUILD_NO_EXCEPT {
+  require_non_null(target);
+  require_non_null(header);
+  require_non_empty(header);
+
+  auto &arena = target->project.arena;
+
+  auto [abs_error, header_path] = get_absolute_path(arena, make_file_path(arena, header));
+  if (abs_error) panic("Couldn't resolve the absolute path for the header % due to an error: %\n", header, abs_error.value);
+
+  auto [check_error, exists] = check_file_exists(header_path);
+  if (check_error) panic("Couldn't validate header path % due to a system eror: %", header_path, check_error.value);
+  if (!exists)     panic("Precompiled header '%' wasn't found, please check the correctness of the specified path and that the file exists\n", header_path);
+
+  target->precompiled_header = header_path;
+}
+
+CBUILD_EXPERIMENTAL_API void enable_builtin_archiver (Project *project) CBUILD_NO_EXCEPT {
+  require_non_null(project);
+
+  project->builtin_archiver = true;
+}
+
+CBUILD_EXPERIMENTAL_API void enable_thin_archive (Target *target) CBUILD_NO_EXCEPT {
+  require_non_null(target);
+
+  if (target->type != Target::Static_Library) panic("Thin archive could be enabled only for static libraries, '%' is not one\n", target->name);
+
+  target->flags.thin_archive = true;
+}
+
+CBUILD_EXPERIMENTAL_API void set_linker (Project *project, Linker_Type linker) CBUILD_NO_EXCEPT {
+  require_non_null(project);
+
+  String linker_path;
+
+  switch (linker) {
+    case Linker_Type_Toolchain: break;
+    case Linker_Type_MSVC: {
+      auto toolchain_type = (project->target_architecture == Target_Arch_x86) ? Toolchain_Type_MSVC_X86 : Toolchain_Type_MSVC_X64;
+
+      auto [found, toolchain] = lookup_toolchain_by_type(project->arena, toolchain_type);
+      if (!found) panic("MSVC linker wasn't found, please make sure MSVC is installed\n");
+
+      linker_path = copy_string(project->arena, toolchain.linker_path);
+      break;
+    }
+    case Linker_Type_LLD: {
+      auto [system_error, path] = find_executable(project->arena, "lld-link.exe");
+      if (system_error)    panic("Couldn't lookup LLD linker due to a system error: %\n", system_error.value);
+      if (path.is_none())  panic("LLD linker wasn't found, please make sure lld-link.exe is added to the system's PATH\n");
+
+      linker_path = path.value;
+      break;
+    }
+    default: panic("Unrecognized linker type value: %\n", static_cast<u32>(linker));
+  }
+
+  project->selected_linker.type = linker;
+  project->selected_linker.path = linker_path;
+}
+
+CBUILD_EXPERIMENTAL_API void set_debug_info_mode (Target *target, Debug_Info_Mode mode) CBUILD_NO_EXCEPT {
+  require_non_null(target);
+
+  if (mode != Debug_Info_Mode_Default && mode != Debug_Info_Mode_Fast_Link)
+    panic("Unrecognized debug info mode value: %\n", static_cast<u32>(mode));
+
+  target->debug_info_mode = mode;
+}
+
+CBUILD_EXPERIMENTAL_API void enable_lto (Target *target, bool thin) CBUILD_NO_EXCEPT {
+  require_non_null(target);
+
+  target->lto.enabled = true;
+  target->lto.thin    = thin;
+}
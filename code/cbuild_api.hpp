@@ -76,6 +76,19 @@ struct Project {
   bool rebuild_required  = false;
   bool registry_disabled = false;
 
+  /*
+    Static libraries are written by cbuild itself, instead of running the archiver, see archive.hpp.
+   */
+  bool builtin_archiver = false;
+
+  /*
+    Linker set with 'set_linker', the path is empty if the toolchain's linker is used.
+   */
+  struct {
+    Linker_Type type = Linker_Type_Toolchain;
+    String      path;
+  } selected_linker;
+
   List<User_Defined_Command> user_defined_commands { global_arena };
 
   /*
@@ -95,7 +108,7 @@ struct Project {
 
   /*
     Cache root is the path to the .cbuild directory where build residuals are persisted, along with the config's
-    tag file and project's shared lib. It doesn't depend on the project's root path to correctly support external
+    cache index and project's shared libs. It doesn't depend on the project's root path to correctly support external
     dependend projects, to avoid scenarios, for example, where a dependent project is in some form of the "extern"
     folder and we create new files there, which would be wrong.
    */
@@ -107,7 +120,12 @@ struct Project {
   const File_Path project_build_location;
 
   const File_Path project_config_build_location { make_file_path(arena, project_build_location, "config") };
-  const File_Path project_library_path          { make_file_path(arena, project_config_build_location, concat_string(arena, name, ".", get_shared_library_extension())) };
+
+  /*
+    Configuration builds are cached under the config folder, keyed by the build file's content and the toolchain used to
+    build it. The path to the library that gets loaded is known only once the key is computed by the project loader.
+   */
+  File_Path project_library_path;
 
   /*
     Path to the folder where all residual and final artifacts will be created (under corresponding nested folders).
@@ -181,12 +199,20 @@ struct Target {
   Project &project;
 
   struct {
-    bool external = false;
-    bool install  = false;
+    bool external     = false;
+    bool install      = false;
+    bool thin_archive = false;
   } flags;
 
   File_Path install_location_overwrite {};
 
+  /*
+    Header that is compiled once and used by every C++ file of the target, empty if the target doesn't have one.
+   */
+  File_Path precompiled_header {};
+
+  Debug_Info_Mode debug_info_mode = Debug_Info_Mode_Default;
+
   List<File_Path>    files          { project.arena };
   List<Include_Path> include_paths  { project.arena };
   List<String>       link_libraries { project.arena };
@@ -202,6 +228,18 @@ struct Target {
     Hook_Func on_linked = nullptr;
   } hooks;
 
+  /*
+    Unity build is enabled if more than one file is allowed per unit, see unity_build.hpp.
+   */
+  struct {
+    u32 files_per_unit = 0;
+  } unity;
+
+  struct {
+    bool enabled = false;
+    bool thin    = false;
+  } lto;
+
   /*
     These fields are set/accessed by the project builder.
    */
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "anyfin/arena.hpp"
+#include "anyfin/option.hpp"
+#include "anyfin/slice.hpp"
+#include "anyfin/startup.hpp"
+#include "anyfin/strings.hpp"
+
+#include "cbuild.hpp"
+
+enum struct Daemon_Request_Type: u32 {
+  Build,
+  Stop,
+};
+
+/*
+  Invoked by the daemon for every build request, with the arguments passed to the client's 'build' command.
+ */
+using Daemon_Build_Handler = u32 (*) (Memory_Arena &arena, Slice<Startup_Argument> args, void *context);
+
+/*
+  Each project gets its own daemon, thus the name of the pipe is derived from the working directory and the project's
+  output folder name.
+ */
+String get_daemon_pipe_name (Memory_Arena &arena, File_Path working_directory, String project_output_dir);
+
+/*
+  Serves build requests until it's stopped by the client, or the project's configuration changes. Arguments the project
+  was loaded with are used to reject requests that would configure the project differently.
+ */
+u32 run_daemon (Memory_Arena &arena, String pipe_name, Slice<Startup_Argument> load_args, Daemon_Build_Handler handler, void *context);
+
+/*
+  Sends the request to the daemon, streaming its output into the logger. Returns the exit code of the request, or
+  opt_none if there's no daemon for the project or it declined the request, in which case the caller should proceed
+  on its own.
+ */
+Option<u32> send_daemon_request (Memory_Arena &arena, String pipe_name, Daemon_Request_Type type, Slice<Startup_Argument> args);
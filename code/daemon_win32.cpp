@@ -0,0 +1,359 @@
+
+#include "anyfin/win32.hpp"
+
+#include "anyfin/base.hpp"
+#include "anyfin/arena.hpp"
+#include "anyfin/array.hpp"
+#include "anyfin/defer.hpp"
+#include "anyfin/file_system.hpp"
+#include "anyfin/hash.hpp"
+#include "anyfin/string_builder.hpp"
+
+#include "cbuild.hpp"
+#include "daemon.hpp"
+#include "workspace.hpp"
+
+extern bool silence_logs_opt;
+extern bool tracing_enabled_opt;
+
+/*
+  Client and the daemon talk over a named pipe. Each connection carries a single request, which consists of the header
+  followed by the arguments, one per line, either as "key=value" or "key". Daemon replies with a stream of frames: the
+  output of the build, which the client forwards into its own log, terminated by either the exit code or a rejection.
+ */
+constexpr u32 daemon_protocol_version = 1;
+
+constexpr u32 daemon_pipe_buffer_size = kilobytes(64);
+
+/*
+  Requests carry only the command line arguments, anything larger than this is not a request sent by cbuild.
+ */
+constexpr u32 daemon_max_payload_size = kilobytes(64);
+
+struct Request_Header {
+  u32 version;
+  Daemon_Request_Type type;
+
+  b32 silence_logs;
+  b32 tracing_enabled;
+
+  u32 payload_size;
+};
+
+struct Frame_Header {
+  enum struct Type: u32 { Output, Exit, Rejected };
+  using enum Type;
+
+  Type type;
+  u32  size;
+};
+
+static bool send_frame (File &pipe, Frame_Header::Type type, const void *payload, u32 size) {
+  Frame_Header header { .type = type, .size = size };
+
+  if (write_bytes_to_file(pipe, reinterpret_cast<u8 *>(&header), sizeof(header)).is_error()) return false;
+  if (size && write_bytes_to_file(pipe, reinterpret_cast<const u8 *>(payload), size).is_error()) return false;
+
+  return true;
+}
+
+static void send_exit_code (File &pipe, u32 exit_code) {
+  send_frame(pipe, Frame_Header::Exit, &exit_code, sizeof(exit_code));
+}
+
+static void send_rejection (File &pipe, String reason) {
+  send_frame(pipe, Frame_Header::Rejected, reason.value, reason.length);
+}
+
+/*
+  Log sink used while the daemon serves a build request. If the client has disconnected, the rest of the output is
+  dropped, but the build still finishes to keep the registry consistent.
+ */
+struct Pipe_Log_Sink {
+  File &pipe;
+  bool  connected = true;
+};
+
+static void write_log_into_pipe (String message, void *context) {
+  auto &sink = *static_cast<Pipe_Log_Sink *>(context);
+  if (!sink.connected) return;
+
+  sink.connected = send_frame(sink.pipe, Frame_Header::Output, message.value, message.length);
+}
+
+static String serialize_arguments (Memory_Arena &arena, Slice<Startup_Argument> args) {
+  String_Builder builder { arena };
+
+  for (auto &arg: args) {
+    if (arg.is_pair()) builder.add(arena, arg.key, "=", arg.value, "\n");
+    else               builder.add(arena, arg.key, "\n");
+  }
+
+  return build_string(arena, builder);
+}
+
+/*
+  Payload comes from the client, thus it's not trusted to be well-formed, the last line may lack its terminator.
+ */
+static Slice<Startup_Argument> deserialize_arguments (Memory_Arena &arena, String payload) {
+  usize count = 1;
+  for (auto symbol: payload) if (symbol == '\n') count += 1;
+
+  auto args = reserve_array<Startup_Argument>(arena, count);
+
+  usize index = 0;
+  split_string(payload, '\n').for_each([&] (String line) {
+    if (index == count) return;
+
+    auto &arg = args[index++];
+
+    for (usize offset = 0; offset < line.length; offset++) {
+      if (line[offset] == '=') {
+        arg = Startup_Argument {
+          .type  = Startup_Argument::Type::Pair,
+          .key   = String(line.value, offset),
+          .value = String(line.value + offset + 1, line.length - offset - 1),
+        };
+
+        return;
+      }
+    }
+
+    arg = Startup_Argument { .type = Startup_Argument::Type::Value, .key = line };
+  });
+
+  return Slice(args.values, index);
+}
+
+/*
+  Arguments are visible to the project's configuration, thus a request is served only if it would configure the
+  project the same way as it was configured at the daemon's startup. Builder's own options don't affect the project.
+ */
+static bool is_same_configuration (Slice<Startup_Argument> loaded, Slice<Startup_Argument> requested) {
+  const auto is_builder_option = [] (const Startup_Argument &arg) {
+    return arg.is_pair() && (arg.key == "builders" || arg.key == "cache"  || arg.key == "targets"     ||
+                             arg.key == "trace"    || arg.key == "report" || arg.key == "report_json" ||
+                             arg.key == "null_toolchain" || arg.key == "progress");
+  };
+
+  const auto find = [&] (Slice<Startup_Argument> args, const Startup_Argument &value) {
+    for (auto &arg: args) {
+      if (arg.type == value.type && arg.key == value.key && arg.value == value.value) return true;
+    }
+
+    return false;
+  };
+
+  usize loaded_count = 0, requested_count = 0;
+
+  for (auto &arg: loaded) {
+    if (is_builder_option(arg)) continue;
+    if (!find(requested, arg))  return false;
+    loaded_count += 1;
+  }
+
+  for (auto &arg: requested) {
+    if (is_builder_option(arg)) continue;
+    if (!find(loaded, arg))     return false;
+    requested_count += 1;
+  }
+
+  return loaded_count == requested_count;
+}
+
+String get_daemon_pipe_name (Memory_Arena &arena, File_Path working_directory, String project_output_dir) {
+  auto absolute_path = get_absolute_path(arena, working_directory).or_default(working_directory);
+
+  auto hash = hash_string(absolute_path);
+  hash = hash_string(project_output_dir, hash);
+
+  return concat_string(arena, "\\\\.\\pipe\\cbuild-", hash);
+}
+
+/*
+  Returns false if the daemon should stop serving requests.
+ */
+static bool serve_request (Memory_Arena &arena, File &pipe, Slice<Startup_Argument> load_args, Daemon_Build_Handler handler, void *context) {
+  Request_Header header;
+  if (read_bytes_into_buffer(pipe, reinterpret_cast<u8 *>(&header), sizeof(header)).is_error()) {
+    log("WARNING: Couldn't read client's request, ignoring it\n");
+    return true;
+  }
+
+  if (header.version != daemon_protocol_version) {
+    send_rejection(pipe, "Daemon was started by a different version of cbuild\n");
+    return true;
+  }
+
+  if (header.type != Daemon_Request_Type::Build && header.type != Daemon_Request_Type::Stop) {
+    send_rejection(pipe, "Daemon received a request of an unknown type\n");
+    return true;
+  }
+
+  if (header.payload_size > daemon_max_payload_size) {
+    send_rejection(pipe, "Daemon received a request that is too large\n");
+    return true;
+  }
+
+  String payload;
+  if (header.payload_size) {
+    auto buffer = reserve<char>(arena, header.payload_size);
+    if (read_bytes_into_buffer(pipe, reinterpret_cast<u8 *>(buffer), header.payload_size).is_error()) {
+      log("WARNING: Couldn't read client's request, ignoring it\n");
+      return true;
+    }
+
+    payload = String(buffer, header.payload_size);
+  }
+
+  if (header.type == Daemon_Request_Type::Stop) {
+    log("Daemon was stopped by the client\n");
+    send_exit_code(pipe, 0);
+    return false;
+  }
+
+  /*
+    Reloading the configuration in place isn't supported, since it's owned by the project's arena. The daemon steps
+    down, leaving the client to build the project on its own, which rebuilds the configuration.
+   */
+  if (is_project_configuration_outdated(arena)) {
+    String reason = "Project configuration has changed, daemon is shutting down\n";
+
+    log(reason);
+    send_rejection(pipe, reason);
+
+    return false;
+  }
+
+  auto args = deserialize_arguments(arena, payload);
+  if (!is_same_configuration(load_args, args)) {
+    send_rejection(pipe, "Daemon was started with different project arguments, building without it\n");
+    return true;
+  }
+
+  log("Serving build request\n");
+
+  auto previous_silence = silence_logs_opt;
+  auto previous_tracing = tracing_enabled_opt;
+
+  silence_logs_opt    = header.silence_logs;
+  tracing_enabled_opt = header.tracing_enabled;
+
+  Pipe_Log_Sink sink { pipe };
+  set_log_sink(write_log_into_pipe, &sink);
+
+  auto exit_code = handler(arena, args, context);
+
+  set_log_sink(nullptr);
+
+  silence_logs_opt    = previous_silence;
+  tracing_enabled_opt = previous_tracing;
+
+  if (sink.connected) send_exit_code(pipe, exit_code);
+
+  log("Build request finished with exit code %\n", exit_code);
+
+  return true;
+}
+
+u32 run_daemon (Memory_Arena &arena, String pipe_name, Slice<Startup_Argument> load_args, Daemon_Build_Handler handler, void *context) {
+  auto handle = CreateNamedPipeA(pipe_name.value,
+                                 PIPE_ACCESS_DUPLEX | FILE_FLAG_FIRST_PIPE_INSTANCE,
+                                 PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+                                 1, daemon_pipe_buffer_size, daemon_pipe_buffer_size, 0, nullptr);
+  if (handle == INVALID_HANDLE_VALUE) {
+    if (GetLastError() == ERROR_ACCESS_DENIED) panic("Daemon for this project is already running\n");
+    panic("Couldn't create daemon's pipe % due to an error: %\n", pipe_name, get_system_error());
+  }
+
+  File pipe { handle, pipe_name };
+  defer { CloseHandle(handle); };
+
+  log("Daemon is ready, listening on %\n", pipe_name);
+
+  bool running = true;
+  while (running) {
+    if (!ConnectNamedPipe(handle, nullptr) && GetLastError() != ERROR_PIPE_CONNECTED) {
+      log("ERROR: Daemon couldn't accept a connection due to an error: %\n", get_system_error());
+      return 1;
+    }
+
+    auto local = arena;
+    running = serve_request(local, pipe, load_args, handler, context);
+
+    FlushFileBuffers(handle);
+    DisconnectNamedPipe(handle);
+  }
+
+  return 0;
+}
+
+static Option<File> connect_to_daemon (String pipe_name) {
+  for (int attempt = 0; attempt < 2; attempt++) {
+    auto handle = CreateFileA(pipe_name.value, GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, 0, nullptr);
+    if (handle != INVALID_HANDLE_VALUE) return File { handle, pipe_name };
+
+    /*
+      Daemon serves one request at a time, if it's busy with another build, wait for it to finish.
+     */
+    if (GetLastError() != ERROR_PIPE_BUSY) return opt_none;
+    if (!WaitNamedPipeA(pipe_name.value, NMPWAIT_WAIT_FOREVER)) return opt_none;
+  }
+
+  return opt_none;
+}
+
+Option<u32> send_daemon_request (Memory_Arena &arena, String pipe_name, Daemon_Request_Type type, Slice<Startup_Argument> args) {
+  auto [connected, pipe] = connect_to_daemon(pipe_name);
+  if (!connected) return opt_none;
+  defer { close_file(pipe); };
+
+  auto payload = serialize_arguments(arena, args);
+
+  Request_Header header {
+    .version         = daemon_protocol_version,
+    .type            = type,
+    .silence_logs    = silence_logs_opt,
+    .tracing_enabled = tracing_enabled_opt,
+    .payload_size    = static_cast<u32>(payload.length),
+  };
+
+  if (write_bytes_to_file(pipe, reinterpret_cast<u8 *>(&header), sizeof(header)).is_error()) return opt_none;
+  if (payload.length && write_bytes_to_file(pipe, payload).is_error()) return opt_none;
+
+  if (!silence_logs_opt && type == Daemon_Request_Type::Build) log("Build request was sent to the daemon\n");
+
+  while (true) {
+    auto local = arena;
+
+    Frame_Header frame;
+    if (read_bytes_into_buffer(pipe, reinterpret_cast<u8 *>(&frame), sizeof(frame)).is_error()) break;
+
+    String frame_payload;
+    if (frame.size) {
+      auto buffer = reserve<char>(local, frame.size);
+      if (read_bytes_into_buffer(pipe, reinterpret_cast<u8 *>(buffer), frame.size).is_error()) break;
+
+      frame_payload = String(buffer, frame.size);
+    }
+
+    switch (frame.type) {
+      case Frame_Header::Output: {
+        log(frame_payload);
+        break;
+      }
+      case Frame_Header::Exit: {
+        fin_ensure(frame.size == sizeof(u32));
+        return *reinterpret_cast<const u32 *>(frame_payload.value);
+      }
+      case Frame_Header::Rejected: {
+        log(frame_payload);
+        return opt_none;
+      }
+    }
+  }
+
+  log("ERROR: Connection to the daemon was lost before the request was completed\n");
+
+  return 1u;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "anyfin/base.hpp"
+#include "anyfin/buffered_writer.hpp"
+#include "anyfin/strings.hpp"
+
+#include "cbuild.hpp"
+
+/*
+  Writes the value as a quoted JSON string. Paths on Win32 are full of backslashes, which must be escaped.
+ */
+static void write_json_string (Buffered_Writer &writer, String value) {
+  ensure(write(writer, '"'));
+
+  for (auto symbol: value) {
+    switch (symbol) {
+      case '"':  ensure(write(writer, "\\\"")); break;
+      case '\\': ensure(write(writer, "\\\\")); break;
+      case '\n': ensure(write(writer, "\\n"));  break;
+      case '\r': ensure(write(writer, "\\r"));  break;
+      case '\t': ensure(write(writer, "\\t"));  break;
+      default:   ensure(write(writer, symbol)); break;
+    }
+  }
+
+  ensure(write(writer, '"'));
+}
@@ -1,16 +1,253 @@
 
+#include "anyfin/atomics.hpp"
 #include "anyfin/concurrent.hpp"
 #include "anyfin/console.hpp"
+#include "anyfin/memory.hpp"
+#include "anyfin/threads.hpp"
 
 /*
-  TODO: This is a temporary solution to get multi-threaded logging going. CBuild doesn't log much, there shouldn't
-  be much contention over the lock. 
+  Logs are written by a background writer. Each log call is a single record that is copied into the shared ring buffer,
+  thus a message, e.g compiler's output for a file, always comes out as a contiguous block and builders never wait on
+  the console. The writer collects pending records into a batch and writes it with a single call.
+
+  Until the writer is started, e.g in tests, messages are written directly by the calling thread.
+ */
+
+using Log_Sink = void (*) (Fin::String message, void *context);
+
+/*
+  Records are aligned to their headers and never wrap around the end of the buffer, if a record doesn't fit into the
+  tail of the buffer, the tail is taken by a padding record.
+ */
+struct alignas(8) Log_Record {
+  static constexpr Fin::u32 Padding = static_cast<Fin::u32>(-1);
+
+  Fin::au32 ready;
+  Fin::u32  length;
+};
+
+constexpr Fin::usize log_buffer_capacity = Fin::megabytes(1);
+constexpr Fin::usize log_batch_capacity  = Fin::kilobytes(64);
+
+/*
+  Messages that wouldn't comfortably fit into the buffer are written directly, once everything before them is out.
  */
+constexpr Fin::usize log_record_size_limit = log_buffer_capacity / 4;
 
+static struct {
+  bool started;
+
+  Fin::Memory_Region region;
+  Fin::u8 *buffer;
+  Fin::u8 *batch;
+
+  Fin::cau64 write_cursor;
+  Fin::cau64 read_cursor;
+
+  Fin::Semaphore records_available;
+  Fin::Thread    writer;
+} log_writer;
+
+/*
+  Guards the sink and the output, taken by the writer while it's writing a batch.
+ */
 static Fin::Spin_Lock log_lock;
 
-void log (Fin::String message) {
+static Log_Sink log_sink;
+static void    *log_sink_context;
+
+static void deliver (Fin::String message) {
+  if (log_sink) log_sink(message, log_sink_context);
+  else          write_to_stdout(message);
+}
+
+static Fin::usize get_record_size (Fin::usize length) {
+  return Fin::align_forward(sizeof(Log_Record) + length, alignof(Log_Record));
+}
+
+/*
+  Writes out committed records in the order these were reserved, stopping at the first one that is still being copied.
+  It's the producer's job to signal the writer again once it's done.
+ */
+static void drain_log_records () {
+  using namespace Fin;
+
+  constexpr auto mask = log_buffer_capacity - 1;
+
+  auto read  = atomic_load(log_writer.read_cursor);
+  auto write = atomic_load<Memory_Order::Acquire>(log_writer.write_cursor);
+
+  usize batch_size = 0;
+  const auto flush_batch = [&] {
+    if (batch_size) write_to_stdout(String(reinterpret_cast<const char *>(log_writer.batch), batch_size));
+    batch_size = 0;
+  };
+
+  log_lock.lock();
+
+  while (read < write) {
+    auto offset = read & mask;
+    auto record = reinterpret_cast<Log_Record *>(log_writer.buffer + offset);
+
+    if (!atomic_load<Memory_Order::Acquire>(record->ready)) break;
+
+    usize record_size = log_buffer_capacity - offset;
+    if (record->length != Log_Record::Padding) {
+      auto message = String(reinterpret_cast<const char *>(record + 1), record->length);
+      record_size  = get_record_size(record->length);
+
+      if (log_sink) deliver(message);
+      else {
+        if (batch_size + message.length > log_batch_capacity) flush_batch();
+
+        if (message.length > log_batch_capacity) write_to_stdout(message);
+        else {
+          copy_memory(log_writer.batch + batch_size, reinterpret_cast<const u8 *>(message.value), message.length);
+          batch_size += message.length;
+        }
+      }
+    }
+
+    /*
+      Headers of the next records could land anywhere in this space, these must not find a stale ready flag.
+     */
+    zero_memory(log_writer.buffer + offset, record_size);
+
+    read += record_size;
+
+    /*
+      Records are released as soon as they are copied into the batch, unblocking producers waiting on the space.
+     */
+    atomic_store<Memory_Order::Release>(log_writer.read_cursor, read);
+  }
+
+  flush_batch();
+
+  log_lock.unlock();
+}
+
+static void log_writer_loop (void *) {
+  while (true) {
+    wait_for_semaphore_signal(log_writer.records_available);
+    drain_log_records();
+  }
+}
+
+void start_log_writer () {
+  using namespace Fin;
+
+  if (log_writer.started) return;
+
+  log_writer.region = reserve_virtual_memory(log_buffer_capacity + log_batch_capacity);
+  if (!log_writer.region.memory) return; // keep writing synchronously
+
+  log_writer.buffer = log_writer.region.memory;
+  log_writer.batch  = log_writer.region.memory + log_buffer_capacity;
+
+  auto [semaphore_error, semaphore] = create_semaphore();
+  if (semaphore_error) {
+    free_virtual_memory(log_writer.region);
+    return;
+  }
+
+  log_writer.records_available = semaphore;
+
+  auto [thread_error, thread] = spawn_thread(log_writer_loop, static_cast<void *>(nullptr));
+  if (thread_error) {
+    destroy(log_writer.records_available);
+    free_virtual_memory(log_writer.region);
+    return;
+  }
+
+  log_writer.writer  = thread;
+  log_writer.started = true;
+}
+
+void flush_logs () {
+  using namespace Fin;
+
+  if (!log_writer.started) return;
+
+  auto target = atomic_load<Memory_Order::Acquire>(log_writer.write_cursor);
+
+  /*
+    The writer could be waiting on a producer that is in the middle of copying its record, it's signaled again once the
+    record is committed.
+   */
+  while (atomic_load<Memory_Order::Acquire>(log_writer.read_cursor) < target) {
+    increment_semaphore(log_writer.records_available);
+    thread_sleep(1);
+  }
+}
+
+void set_log_sink (Log_Sink sink, void *context) {
+  /*
+    Pending messages belong to the previous sink.
+   */
+  flush_logs();
+
+  log_lock.lock();
+  log_sink         = sink;
+  log_sink_context = context;
+  log_lock.unlock();
+}
+
+static void write_log_directly (Fin::String message) {
   log_lock.lock();
-  write_to_stdout(message);
+  deliver(message);
   log_lock.unlock();
 }
+
+void log (Fin::String message) {
+  using namespace Fin;
+
+  if (!log_writer.started) return write_log_directly(message);
+
+  if (message.length > log_record_size_limit) {
+    flush_logs();
+    return write_log_directly(message);
+  }
+
+  constexpr auto mask = log_buffer_capacity - 1;
+
+  const auto record_size = get_record_size(message.length);
+
+  usize padding = 0;
+  auto  write   = atomic_load(log_writer.write_cursor);
+
+  while (true) {
+    auto tail = log_buffer_capacity - (write & mask);
+    padding   = (record_size <= tail) ? 0 : tail;
+
+    /*
+      If the writer is behind, e.g the console is blocked, wait for it to free up the space. This is the only case when
+      logging waits on the output.
+     */
+    auto read = atomic_load<Memory_Order::Acquire>(log_writer.read_cursor);
+    if (write + padding + record_size - read > log_buffer_capacity) {
+      increment_semaphore(log_writer.records_available);
+      thread_sleep(0);
+
+      write = atomic_load(log_writer.write_cursor);
+      continue;
+    }
+
+    if (atomic_compare_and_set(log_writer.write_cursor, write, write + padding + record_size)) break;
+
+    write = atomic_load(log_writer.write_cursor);
+  }
+
+  if (padding) {
+    auto filler = reinterpret_cast<Log_Record *>(log_writer.buffer + (write & mask));
+    filler->length = Log_Record::Padding;
+    atomic_store<Memory_Order::Release>(filler->ready, 1);
+  }
+
+  auto record = reinterpret_cast<Log_Record *>(log_writer.buffer + ((write + padding) & mask));
+  record->length = static_cast<u32>(message.length);
+  copy_memory(reinterpret_cast<u8 *>(record + 1), reinterpret_cast<const u8 *>(message.value), message.length);
+
+  atomic_store<Memory_Order::Release>(record->ready, 1);
+
+  increment_semaphore(log_writer.records_available);
+}
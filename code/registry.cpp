@@ -176,9 +176,22 @@ void flush_registry (Registry &registry, const Update_Set &update_set) {
 
   auto flush_buffer_size = usize(records + count) - usize(update_set.buffer);
 
+  /*
+    Update set doesn't reference the mapped memory, thus it's safe to release the mapping at this point. Windows
+    wouldn't allow truncating the file while it's mapped.
+   */
+  unmap_file(registry.registry_file_mapping);
+  registry.registry_file_mapping = {};
+
   ensure(reset_file_cursor(registry.registry_file), "Failed to reset registry file pointer\n");
   ensure(write_bytes_to_file(registry.registry_file, update_set.buffer, flush_buffer_size),
          "Failed to persiste build information into a cache file. Full rebuild will likely happen next run\n");
 
+  /*
+    If the new content is smaller than what was in the file before, e.g after compaction or when dependencies
+    were removed, the tail of the old content should be dropped.
+   */
+  ensure(truncate_file(registry.registry_file), "Failed to truncate the registry file\n");
+
   close_file(registry.registry_file);
 }
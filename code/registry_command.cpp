@@ -0,0 +1,449 @@
+
+#include "anyfin/base.hpp"
+#include "anyfin/array.hpp"
+#include "anyfin/array_ops.hpp"
+#include "anyfin/buffered_writer.hpp"
+#include "anyfin/defer.hpp"
+#include "anyfin/file_system.hpp"
+#include "anyfin/hash.hpp"
+#include "anyfin/list.hpp"
+#include "anyfin/math.hpp"
+#include "anyfin/memory.hpp"
+
+#include "cbuild_api.hpp"
+#include "registry.hpp"
+#include "scanner.hpp"
+#include "registry_command.hpp"
+#include "unity_build.hpp"
+
+/*
+  Registry dump of a large project has hundreds of thousands of rows, writing these out one by one makes the
+  command spend all of its time in the system calls.
+ */
+constexpr inline usize output_buffer_size = kilobytes(64);
+
+/*
+  Computes the number of bytes that the registry's content should occupy, based on the counters in the header.
+  Follows the layout that `load_registry` expects, with sections aligned relative to the start of the file.
+ */
+static usize get_registry_layout_size (const Registry::Header &header) {
+  usize size = sizeof(Registry::Header) + sizeof(Registry::Target_Info) * header.targets_count;
+
+  size  = align_forward(size, 32);
+  size += (sizeof(u64) + sizeof(Registry::Record)) * header.aligned_total_files_count;
+  size  = align_forward(size, 32);
+  size += (sizeof(u64) + sizeof(Registry::Record)) * header.dependencies_count;
+
+  return size;
+}
+
+/*
+  Names are stored in a fixed size buffer, which is null-terminated only if the name is shorter than the limit.
+ */
+static String get_target_name (const Registry::Target_Info &info) {
+  usize length = 0;
+  while (length < Target::Max_Name_Limit && info.name[length]) length += 1;
+
+  return String(info.name, length);
+}
+
+static void print_stats (Buffered_Writer &out, const Registry &registry, File_Path path, usize file_size) {
+  auto &records = registry.records;
+  auto &header  = records.header;
+
+  u64 total_files_count = 0;
+  for (usize idx = 0; idx < header.targets_count; idx++) total_files_count += records.targets[idx].files_count.value;
+
+  auto layout_size = get_registry_layout_size(header);
+
+  ensure(write(out, "Registry: ", path, "\n"));
+  ensure(write(out, "  Version:      ", header.version, "\n"));
+  ensure(write(out, "  Size:         ", file_size, " bytes (", file_size - layout_size, " unused)\n"));
+  ensure(write(out, "  Targets:      ", header.targets_count, "\n"));
+  ensure(write(out, "  Files:        ", total_files_count, " (", header.aligned_total_files_count, " slots)\n"));
+  ensure(write(out, "  Dependencies: ", header.dependencies_count, "\n"));
+
+  if (header.targets_count == 0) return;
+
+  ensure(write(out, "\nTargets:\n"));
+  for (usize idx = 0; idx < header.targets_count; idx++) {
+    auto &target = records.targets[idx];
+    ensure(write(out, "  ", get_target_name(target), ": ", target.files_count.value, " files (",
+                 target.aligned_max_files_count, " slots) at offset ", target.files_offset, "\n"));
+  }
+}
+
+static void print_record (Buffered_Writer &out, usize index, u64 id, const Registry::Record &record) {
+  ensure(write(out, "  ", index, ") ID: ", id, ", TS: ", record.timestamp, ", H: ", record.hash, "\n"));
+}
+
+static u32 dump_records (Buffered_Writer &out, const Registry &registry, String target_name) {
+  auto &records = registry.records;
+  auto &header  = records.header;
+
+  bool target_found = false;
+  for (usize idx = 0; idx < header.targets_count; idx++) {
+    auto &target = records.targets[idx];
+    auto  name   = get_target_name(target);
+
+    if (target_name && name != target_name) continue;
+    target_found = true;
+
+    u64 files_count = target.files_count.value;
+    ensure(write(out, "Target: ", name, " (", files_count, " files, ", target.aligned_max_files_count,
+                 " slots, offset ", target.files_offset, ")\n"));
+
+    for (usize file_idx = 0; file_idx < files_count; file_idx++) {
+      auto offset = target.files_offset + file_idx;
+      print_record(out, offset, records.files[offset], records.file_records[offset]);
+    }
+
+    ensure(write(out, '\n'));
+  }
+
+  if (target_name) {
+    if (target_found) return 0;
+
+    ensure(flush(out));
+    log("ERROR: Target '%' not found in the registry\n", target_name);
+    return 1;
+  }
+
+  ensure(write(out, "Dependencies: ", header.dependencies_count, "\n"));
+  for (usize idx = 0; idx < header.dependencies_count; idx++) {
+    print_record(out, idx, records.dependencies[idx], records.dependency_records[idx]);
+  }
+
+  return 0;
+}
+
+static u32 verify_records (Memory_Arena &arena, Buffered_Writer &out, const Registry &registry, usize file_size) {
+  auto &records = registry.records;
+  auto &header  = records.header;
+
+  u32 problems_count = 0;
+  auto report = [&] (auto &&... message) {
+    problems_count += 1;
+    ensure(write(out, "  - ", message..., "\n"));
+  };
+
+  if (header.version != Registry::Version) {
+    report("Unsupported registry version ", header.version, ", expected ", Registry::Version);
+  }
+
+  if (!is_aligned_by(header.aligned_total_files_count, 4)) {
+    report("Total files count ", header.aligned_total_files_count, " is not aligned on a 4-record boundary");
+  }
+
+  if (header.aligned_total_files_count + header.dependencies_count > max_supported_files_count) {
+    report("Registry holds more records than supported: ", header.aligned_total_files_count + header.dependencies_count);
+  }
+
+  auto layout_size = get_registry_layout_size(header);
+  if (layout_size > file_size) {
+    /*
+      Nothing else could be safely checked, since records would point past the end of the file.
+     */
+    report("Registry file is truncated, expected at least ", layout_size, " bytes, found ", file_size);
+    return problems_count;
+  }
+
+  auto ids_capacity = header.aligned_total_files_count > header.dependencies_count ? header.aligned_total_files_count : header.dependencies_count;
+
+  /*
+    Set of the ids seen in a section, used to spot duplicates. Table is kept at most half full.
+   */
+  auto ids = reserve_array<u64>(arena, align_forward_to_pow_2(ids_capacity * 2 + 2));
+
+  const auto reset_ids = [&ids] {
+    zero_memory(ids.values, ids.count);
+  };
+
+  /*
+    Returns false if the id is already in the set.
+   */
+  const auto insert_id = [&ids] (u64 id) {
+    auto key   = make_table_key(hash_value(id));
+    auto &slot = ids[find_table_slot(ids, key)];
+    if (slot == key) return false;
+
+    slot = key;
+    return true;
+  };
+
+  reset_ids();
+
+  usize total_slots = 0;
+  for (usize idx = 0; idx < header.targets_count; idx++) {
+    auto &target = records.targets[idx];
+    auto  name   = get_target_name(target);
+
+    u64 files_count = target.files_count.value;
+
+    if (is_empty(name)) report("Target #", idx, " has no name");
+
+    for (usize other = 0; other < idx; other++) {
+      if (compare_bytes(target.name, records.targets[other].name, Target::Max_Name_Limit))
+        report("Target '", name, "' is listed more than once");
+    }
+
+    if (!is_aligned_by(target.files_offset, 4) || !is_aligned_by(target.aligned_max_files_count, 4))
+      report("Target '", name, "' files section is not aligned on a 4-record boundary");
+
+    if (files_count > target.aligned_max_files_count)
+      report("Target '", name, "' has ", files_count, " files, which exceeds its capacity of ", target.aligned_max_files_count);
+
+    if (target.files_offset + target.aligned_max_files_count > header.aligned_total_files_count) {
+      report("Target '", name, "' files section [", target.files_offset, ", ", target.files_offset + target.aligned_max_files_count,
+             ") is outside of the files table of ", header.aligned_total_files_count, " slots");
+      continue;
+    }
+
+    for (usize other = 0; other < idx; other++) {
+      auto &other_target = records.targets[other];
+
+      auto starts_before_end = target.files_offset < other_target.files_offset + other_target.aligned_max_files_count;
+      auto ends_after_start  = other_target.files_offset < target.files_offset + target.aligned_max_files_count;
+      if (starts_before_end && ends_after_start)
+        report("Files sections of targets '", name, "' and '", get_target_name(other_target), "' overlap");
+    }
+
+    total_slots += target.aligned_max_files_count;
+
+    reset_ids();
+
+    auto section = records.files + target.files_offset;
+    for (usize file_idx = 0; file_idx < target.aligned_max_files_count; file_idx++) {
+      auto id = section[file_idx];
+
+      if (file_idx >= files_count) {
+        if (id != 0) report("Target '", name, "' has a record in the unused slot ", file_idx);
+        continue;
+      }
+
+      if (id == 0)               report("Target '", name, "' has an empty file id at slot ", file_idx);
+      else if (!insert_id(id)) report("Target '", name, "' lists file id ", id, " more than once");
+    }
+  }
+
+  if (total_slots > header.aligned_total_files_count)
+    report("Targets claim ", total_slots, " file slots, while the table has only ", header.aligned_total_files_count);
+
+  reset_ids();
+
+  for (usize idx = 0; idx < header.dependencies_count; idx++) {
+    auto id = records.dependencies[idx];
+
+    if (id == 0)               report("Dependency #", idx, " has an empty file id");
+    else if (!insert_id(id)) report("Dependency id ", id, " is listed more than once");
+  }
+
+  return problems_count;
+}
+
+u32 inspect_registry (Memory_Arena &arena, File_Path registry_file_path, Registry_Command_Mode mode, String target_name) {
+  fin_ensure(mode != Registry_Command_Mode::Compact);
+
+  if (!check_file_exists(registry_file_path).or_default(false)) {
+    log("Registry file not found at %, the project must be built at least once with the cache enabled\n", registry_file_path);
+    return 1;
+  }
+
+  Registry registry { .registry_file = unwrap(open_file(registry_file_path)) };
+  defer { close_file(registry.registry_file); };
+
+  Buffered_Writer out { arena, output_buffer_size };
+
+  auto file_size = unwrap(get_file_size(registry.registry_file));
+  if (file_size == 0) {
+    log("Registry at % is empty\n", registry_file_path);
+    return 0;
+  }
+
+  if (file_size < sizeof(Registry::Header)) {
+    log("ERROR: Registry file at % is corrupted, it's smaller than the registry header\n", registry_file_path);
+    return 1;
+  }
+
+  load_registry(arena, registry);
+  defer { unmap_file(registry.registry_file_mapping); };
+
+  u32 exit_code = 0;
+
+  if (mode == Registry_Command_Mode::Verify) {
+    ensure(write(out, "Verifying registry: ", registry_file_path, "\n"));
+
+    auto problems_count = verify_records(arena, out, registry, file_size);
+    if (problems_count) {
+      ensure(write(out, "Registry verification failed, ", problems_count, " problem(s) found\n"));
+      exit_code = 1;
+    }
+    else ensure(write(out, "No problems found\n"));
+
+    ensure(flush(out));
+    return exit_code;
+  }
+
+  if (get_registry_layout_size(registry.records.header) > file_size) {
+    log("ERROR: Registry file at % is corrupted, run 'cbuild registry verify' for details\n", registry_file_path);
+    return 1;
+  }
+
+  switch (mode) {
+    case Registry_Command_Mode::Stats: {
+      print_stats(out, registry, registry_file_path, file_size);
+      break;
+    }
+    case Registry_Command_Mode::Dump: {
+      exit_code = dump_records(out, registry, target_name);
+      break;
+    }
+    default: break;
+  }
+
+  ensure(flush(out));
+
+  return exit_code;
+}
+
+u32 compact_registry (Memory_Arena &arena, const Project &project, File_Path registry_file_path) {
+  if (project.registry_disabled) {
+    log("Registry is disabled for this project, nothing to compact\n");
+    return 0;
+  }
+
+  if (!check_file_exists(registry_file_path).or_default(false)) {
+    log("Registry file not found at %, nothing to compact\n", registry_file_path);
+    return 0;
+  }
+
+  auto registry = create_registry(registry_file_path);
+
+  auto old_file_size = unwrap(get_file_size(registry.registry_file));
+  if (old_file_size < sizeof(Registry::Header)) {
+    close_file(registry.registry_file);
+    log("Registry at % is empty, nothing to compact\n", registry_file_path);
+    return 0;
+  }
+
+  load_registry(arena, registry);
+
+  auto &records = registry.records;
+  if (records.header.version != Registry::Version || get_registry_layout_size(records.header) > old_file_size) {
+    unmap_file(registry.registry_file_mapping);
+    close_file(registry.registry_file);
+    log("ERROR: Registry at % cannot be compacted, run 'cbuild registry verify' for details\n", registry_file_path);
+    return 1;
+  }
+
+  auto old_dependencies_count = records.header.dependencies_count;
+
+  auto update_set = init_update_set(arena, project, registry, false);
+
+  /*
+    File records are carried over as is, targets that are no longer part of the project are dropped by the update set.
+   */
+  for (auto &target: project.targets) {
+    auto last_info = reinterpret_cast<Registry::Target_Info *>(target.build_context.last_info);
+    if (!last_info) continue;
+
+    auto info = reinterpret_cast<Registry::Target_Info *>(target.build_context.info);
+
+    u64 count = last_info->files_count.value;
+    if (count > info->aligned_max_files_count) count = info->aligned_max_files_count;
+
+    copy_memory(update_set.files        + info->files_offset, records.files        + last_info->files_offset, count);
+    copy_memory(update_set.file_records + info->files_offset, records.file_records + last_info->files_offset, count);
+
+    info->files_count.value = count;
+  }
+
+  /*
+    Collecting every dependency that is still reachable from the project's translation units. Scanner leaves
+    the current timestamps in the update set, which must not be persisted here, otherwise the next build would
+    miss the changes made since the last build. These are replaced with the old records below.
+   */
+  Chain_Scanner scanner(arena, registry, update_set);
+
+  List<Include_Path> project_include_paths { arena };
+  for (auto &path: project.include_paths) list_push_copy(project_include_paths, path);
+
+  for (auto &target: project.targets) {
+    auto scan_file = [&] (File_Path file_path) {
+      auto local = arena;
+
+      auto [open_error, file] = open_file(file_path);
+      if (open_error) return true; // Removed files are dropped with their includes.
+
+      List<Include_Path> include_paths(local, project_include_paths);
+      for (auto &path: target.include_paths) list_push_front_copy(include_paths, path);
+
+      scan_dependency_chain(local, scanner, include_paths, file);
+
+      close_file(file);
+
+      return true;
+    };
+
+    for (auto &file_path: target.files) scan_file(file_path);
+
+    /*
+      Precompiled header is tracked as a dependency of its own, since translation units don't have to include it.
+     */
+    if (target.precompiled_header) {
+      auto local = arena;
+
+      auto [open_error, header] = open_file(target.precompiled_header);
+      if (!open_error) {
+        List<Include_Path> include_paths(local, project_include_paths);
+        for (auto &path: target.include_paths) list_push_front_copy(include_paths, path);
+
+        scan_header_chain(local, scanner, include_paths, header);
+
+        close_file(header);
+      }
+    }
+
+    /*
+      Members of unity units are the units' dependencies, which are reachable only from the units themselves.
+     */
+    if (target.unity.files_per_unit > 1) {
+      auto unity_folder = get_unity_folder_path(arena, target);
+      if (!check_directory_exists(unity_folder).or_default(false)) continue;
+
+      const String extensions [] { ".cpp", ".c" };
+      for (auto extension: extensions) for_each_file(unity_folder, extension, false, scan_file);
+    }
+  }
+
+  /*
+    Only dependencies that are known to the current registry are kept. New includes, that the last build hasn't seen,
+    must look new to the next build as well.
+   */
+  auto old_dependencies = get_dependencies(registry);
+
+  u32 kept_count = 0;
+  for (u32 idx = 0; idx < update_set.header->dependencies_count; idx++) {
+    auto id = update_set.dependencies[idx];
+
+    auto [found, old_index] = find_offset(old_dependencies, id);
+    if (!found) continue;
+
+    update_set.dependencies[kept_count]       = id;
+    update_set.dependency_records[kept_count] = records.dependency_records[old_index];
+    kept_count += 1;
+  }
+
+  update_set.header->dependencies_count = kept_count;
+
+  flush_registry(registry, update_set);
+
+  auto registry_file = unwrap(open_file(registry_file_path));
+  auto new_file_size = unwrap(get_file_size(registry_file));
+  close_file(registry_file);
+
+  log("Registry compacted: % -> % dependencies, % -> % bytes\n",
+      old_dependencies_count, kept_count, old_file_size, new_file_size);
+
+  return 0;
+}
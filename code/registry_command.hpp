@@ -0,0 +1,39 @@
+#pragma once
+
+#include "anyfin/arena.hpp"
+#include "anyfin/file_system.hpp"
+
+#include "cbuild.hpp"
+#include "cbuild_api.hpp"
+
+enum struct Registry_Command_Mode {
+  /*
+    Prints a summary of what's stored in the registry.
+   */
+  Stats,
+
+  /*
+    Prints every record in the registry, optionally limited to a single target.
+   */
+  Dump,
+
+  /*
+    Checks structural invariants of the registry file, failing if any of them don't hold.
+   */
+  Verify,
+
+  /*
+    Rewrites the registry dropping obsolete targets and dependencies that are no longer reachable from the project's files.
+   */
+  Compact
+};
+
+/*
+  Read-only inspection of the registry file at the given path. Returns the exit code for the command.
+ */
+u32 inspect_registry (Memory_Arena &arena, File_Path registry_file_path, Registry_Command_Mode mode, String target_name);
+
+/*
+  Compaction requires loaded project configuration to know which targets, files and their includes are still relevant.
+ */
+u32 compact_registry (Memory_Arena &arena, const Project &project, File_Path registry_file_path);
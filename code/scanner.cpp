@@ -2,45 +2,16 @@
 #include "anyfin/base.hpp"
 #include "anyfin/console.hpp"
 #include "anyfin/array_ops.hpp"
+#include "anyfin/defer.hpp"
+#include "anyfin/hash.hpp"
+#include "anyfin/list.hpp"
+#include "anyfin/memory.hpp"
+#include "anyfin/string_builder.hpp"
 
 #include "scanner.hpp"
 
 extern bool tracing_enabled_opt;
 
-struct Dependency_Iterator {
-  const File   &file;
-  File_Mapping  mapping;
-  const char   *cursor;
-  const char   *end;
-
-  constexpr Dependency_Iterator (const File &_file, File_Mapping _mapping)
-    : file    { _file },
-      mapping { _mapping },
-      cursor  { mapping.memory },
-      end     { mapping.memory + mapping.size }
-  {}
-
-  constexpr auto & operator += (usize by) {
-    this->cursor += by;
-    return *this;
-  }
-
-  constexpr auto & operator ++ (int) {
-    this->cursor++;
-    return *this;
-  }
-};
-
-enum struct Parse_Error {
-  Invalid_Value
-};
-
-/*
-  Iterates over all user-defined #include directives in the mapped source file retrieving the provided value as-is.
-  Resolution of the retrieved file path is left for the caller.
- */
-Option<String> get_next_include_value (Dependency_Iterator &iterator);
-
 static bool advance (Dependency_Iterator &iterator, usize by = 1) {
   if (iterator.cursor == iterator.end) return false;
 
@@ -344,10 +315,333 @@ Option<String> get_next_include_value (Dependency_Iterator &iterator) {
   return opt_none;
 }
 
-static Chain_Status scan_dependency_chain (Memory_Arena &arena, Chain_Scanner &scanner, const List<Include_Path> &extra_include_directories, const File &file, bool is_included_file) {
-  if (tracing_enabled_opt && !is_included_file) log("Scanning file: %\n", file.path);
-  
-  auto file_id = unwrap(get_file_id(file));
+/*
+  Files scanned by a long running process, i.e the daemon or the watcher, are remembered between builds, thus a file
+  that hasn't changed since it was scanned isn't parsed again. While the watcher vouches for its tree, files it hasn't
+  reported as changed aren't even opened, and their includes are taken from the previous resolution.
+ */
+struct Scan_Entry {
+  u64 key;
+  u64 file_id;
+  u64 timestamp;
+
+  Slice<String>    values;
+  Slice<File_Path> resolved;
+
+  /*
+    Resolution depends on the include directories, and on the files that exist in these.
+   */
+  u64 directories_key;
+  u32 layout_generation;
+
+  u32  trust_generation;
+  bool watched;
+  bool parsed;
+  bool resolved_all;
+};
+
+/*
+  Table is sized from the project's files count, leaving room for headers, and grows with the project. Cached paths are
+  kept in blocks that are added as these fill up.
+ */
+constexpr usize scan_cache_entries_per_file = 4;
+constexpr usize scan_cache_min_capacity     = 1 << 12;
+constexpr usize scan_cache_root_size        = kilobytes(4);
+constexpr usize scan_cache_block_size       = megabytes(1);
+
+/*
+  Budget of the storage per table's slot, storage taken by earlier scans of changed files isn't reused, the cache starts
+  over once the storage goes past the budget.
+ */
+constexpr usize scan_cache_storage_per_slot = kilobytes(1);
+
+/*
+  Header of the storage block, placed at the beginning of the block's memory.
+ */
+struct Scan_Storage_Block {
+  Scan_Storage_Block *previous;
+  Memory_Region       region;
+};
+
+static struct {
+  bool enabled;
+
+  /*
+    Entries checked before the trust generation changed are checked again, includes resolved before the layout
+    generation changed are resolved again. Generations start at 1, thus zeroed entries are never current.
+   */
+  u32 trust_generation;
+  u32 layout_generation;
+
+  Memory_Region table_region;
+
+  Scan_Entry *entries;
+  usize       entries_count;
+  usize       capacity;
+
+  char      root_buffer[scan_cache_root_size];
+  File_Path watched_root;
+
+  Scan_Storage_Block *storage;
+  usize               storage_offset;
+  usize               storage_size;
+} scan_cache;
+
+void enable_scan_cache () {
+  if (scan_cache.enabled) return;
+
+  scan_cache.trust_generation  = 1;
+  scan_cache.layout_generation = 1;
+  scan_cache.enabled           = true;
+}
+
+void trust_scan_cache (Memory_Arena &arena, File_Path watched_root) {
+  if (!scan_cache.enabled) return;
+
+  auto local = arena;
+
+  auto [error, root] = get_absolute_path(local, watched_root);
+  if (error || root.length >= scan_cache_root_size) return;
+
+  copy_memory(scan_cache.root_buffer, root.value, root.length);
+  scan_cache.root_buffer[root.length] = '\0';
+
+  scan_cache.watched_root = File_Path(scan_cache.root_buffer, root.length);
+}
+
+static void release_scan_cache_storage () {
+  while (scan_cache.storage) {
+    auto region = scan_cache.storage->region;
+    scan_cache.storage = scan_cache.storage->previous;
+
+    free_virtual_memory(region);
+  }
+
+  scan_cache.storage_offset = 0;
+  scan_cache.storage_size   = 0;
+}
+
+static void reset_scan_cache () {
+  if (scan_cache.entries) zero_memory(scan_cache.entries, scan_cache.capacity);
+
+  scan_cache.entries_count = 0;
+  release_scan_cache_storage();
+}
+
+void prepare_scan_cache (usize files_count) {
+  if (!scan_cache.enabled) return;
+
+  auto required_capacity = align_forward_to_pow_2(files_count * scan_cache_entries_per_file);
+  if (required_capacity < scan_cache_min_capacity) required_capacity = scan_cache_min_capacity;
+
+  if (required_capacity > scan_cache.capacity) {
+    release_scan_cache_storage();
+    free_virtual_memory(scan_cache.table_region);
+
+    /*
+      Fresh memory is zeroed, which is an empty table. If it couldn't be reserved, files are scanned from scratch.
+     */
+    scan_cache.table_region  = reserve_virtual_memory(required_capacity * sizeof(Scan_Entry));
+    scan_cache.entries       = reinterpret_cast<Scan_Entry *>(scan_cache.table_region.memory);
+    scan_cache.capacity      = scan_cache.entries ? required_capacity : 0;
+    scan_cache.entries_count = 0;
+
+    return;
+  }
+
+  if (scan_cache.entries_count >= scan_cache.capacity / 4 ||
+      scan_cache.storage_size  >= scan_cache.capacity * scan_cache_storage_per_slot)
+    reset_scan_cache();
+}
+
+static bool is_path_separator (char value) {
+  return value == '\\' || value == '/';
+}
+
+static char to_lower_case (char value) {
+  return (value >= 'A' && value <= 'Z') ? value + ('a' - 'A') : value;
+}
+
+static bool is_same_path_symbol (char left, char right) {
+  if (is_path_separator(left) && is_path_separator(right)) return true;
+  return to_lower_case(left) == to_lower_case(right);
+}
+
+bool is_same_path (String left, String right) {
+  while (left.length  && is_path_separator(left[left.length - 1]))   left.length  -= 1;
+  while (right.length && is_path_separator(right[right.length - 1])) right.length -= 1;
+
+  if (left.length != right.length) return false;
+
+  for (usize idx = 0; idx < left.length; idx++) {
+    if (!is_same_path_symbol(left[idx], right[idx])) return false;
+  }
+
+  return true;
+}
+
+bool is_under_folder (File_Path folder, File_Path path) {
+  if (is_empty(folder) || path.length <= folder.length) return false;
+
+  for (usize idx = 0; idx < folder.length; idx++) {
+    if (!is_same_path_symbol(folder[idx], path[idx])) return false;
+  }
+
+  return is_path_separator(folder[folder.length - 1]) || is_path_separator(path[folder.length]);
+}
+
+/*
+  Keys are built the same way paths are compared.
+ */
+static u64 get_path_key (File_Path path) {
+  u64 hash = fnv_offset_basis;
+
+  for (auto symbol: path) {
+    auto normalized = is_path_separator(symbol) ? '\\' : to_lower_case(symbol);
+    hash = hash_value(normalized, hash);
+  }
+
+  return make_table_key(hash);
+}
+
+static Scan_Entry * find_scan_entry (Memory_Arena &arena, File_Path path, bool insert) {
+  if (!scan_cache.enabled || !scan_cache.entries) return nullptr;
+
+  auto local = arena;
+
+  /*
+    Same file could be reached through different paths, e.g "../" segments of includes, these are folded first.
+   */
+  auto full_path = get_absolute_path(local, path).or_default(path);
+  auto key       = get_path_key(full_path);
+
+  auto &entry = scan_cache.entries[find_table_slot(scan_cache.entries, scan_cache.capacity, key)];
+  if (entry.key == 0) {
+    /*
+      Table is never filled up past the half, files that don't fit are scanned as usual.
+     */
+    if (!insert || scan_cache.entries_count >= scan_cache.capacity / 2) return nullptr;
+
+    entry = Scan_Entry { .key = key };
+    scan_cache.entries_count += 1;
+  }
+
+  entry.watched = is_under_folder(scan_cache.watched_root, full_path);
+
+  return &entry;
+}
+
+void mark_scan_cache_changed (Memory_Arena &arena, File_Path path) {
+  if (!scan_cache.enabled) return;
+
+  if (is_empty(path)) {
+    scan_cache.trust_generation  += 1;
+    scan_cache.layout_generation += 1;
+    return;
+  }
+
+  if (auto entry = find_scan_entry(arena, path, false)) entry->trust_generation = 0;
+}
+
+static bool is_trusted (const Scan_Entry &entry) {
+  return entry.watched && entry.parsed && entry.trust_generation == scan_cache.trust_generation;
+}
+
+/*
+  Copies paths into the cache's storage, adding a block if these don't fit into the current one. Returns false if the
+  memory for the block couldn't be reserved.
+ */
+static bool store_paths (Slice<String> &stored, Slice<String> paths) {
+  usize required = paths.count * sizeof(String) + alignof(String);
+  for (auto &path: paths) required += path.length + 1;
+
+  auto has_room = scan_cache.storage && (scan_cache.storage_offset + required < scan_cache.storage->region.size);
+  if (!has_room) {
+    auto block_size = sizeof(Scan_Storage_Block) + required;
+    if (block_size < scan_cache_block_size) block_size = scan_cache_block_size;
+
+    auto region = reserve_virtual_memory(block_size);
+    if (!region.memory) return false;
+
+    auto block = reinterpret_cast<Scan_Storage_Block *>(region.memory);
+    *block = Scan_Storage_Block { .previous = scan_cache.storage, .region = region };
+
+    scan_cache.storage         = block;
+    scan_cache.storage_offset  = sizeof(Scan_Storage_Block);
+    scan_cache.storage_size   += region.size;
+  }
+
+  Memory_Arena storage { scan_cache.storage->region.memory, scan_cache.storage->region.size };
+  storage.offset = scan_cache.storage_offset;
+
+  auto values = reserve_array<String>(storage, paths.count);
+  for (usize idx = 0; idx < paths.count; idx++) values[idx] = copy_string(storage, paths[idx]);
+
+  scan_cache.storage_offset = storage.offset;
+  stored = Slice(values.values, values.count);
+
+  return true;
+}
+
+static u64 get_directories_key (const List<Include_Path> &directories) {
+  u64 key = fnv_offset_basis;
+
+  for (auto &directory: directories) {
+    if (directory.kind == Include_Path::System) continue;
+    key = hash_string(directory.value, hash_value('\n', key));
+  }
+
+  return key;
+}
+
+static Slice<String> parse_include_values (Memory_Arena &arena, const File &file, File_Mapping mapping) {
+  List<String> values { arena };
+
+  auto iterator = Dependency_Iterator(file, mapping);
+  while (auto include_value = get_next_include_value(iterator)) list_push(values, include_value.value);
+
+  auto result = reserve_array<String>(arena, values.count);
+  for (usize idx = 0; auto &value: values) result[idx++] = value;
+
+  return Slice(result.values, result.count);
+}
+
+static Chain_Status scan_dependency_chain (Memory_Arena &arena, Chain_Scanner &scanner, const List<Include_Path> &extra_include_directories, u64 directories_key, File_Path path, const File *opened_file, bool is_included_file) {
+  if (tracing_enabled_opt && !is_included_file) log("Scanning file: %\n", path);
+
+  auto entry   = find_scan_entry(arena, path, true);
+  auto trusted = entry && is_trusted(*entry);
+
+  /*
+    Included files are opened only if these have to be checked, translation units are opened by the caller.
+   */
+  File file {};
+  bool file_opened = false;
+  defer { if (file_opened) close_file(file); };
+
+  u64 file_id   = 0;
+  u64 timestamp = 0;
+
+  if (trusted) {
+    file_id   = entry->file_id;
+    timestamp = entry->timestamp;
+  }
+  else {
+    if (opened_file) file = *opened_file;
+    else {
+      auto [open_error, included_file] = open_file(path);
+      if (open_error) {
+        log("WARNING: Couldn't open included header file for scanning due to a system error: %.", open_error.value);
+        return Chain_Status::Updated;
+      }
+
+      file        = included_file;
+      file_opened = true;
+    }
+
+    file_id   = unwrap(get_file_id(file));
+    timestamp = unwrap(get_last_update_timestamp(file));
+  }
 
   usize dependency_file_index = 0; // Only for included files
   if (is_included_file) {
@@ -381,70 +675,125 @@ static Chain_Status scan_dependency_chain (Memory_Arena &arena, Chain_Scanner &s
     scanner.status_cache[dependency_file_index]      = Chain_Status::Checking;
   }
 
-  List<Include_Path> include_directories(arena, extra_include_directories);
+  File_Mapping mapping {};
+  bool file_mapped = false;
+  defer { if (file_mapped) unmap_file(mapping); };
 
-  auto [error, path] = get_folder_path(arena, file.path);
-  if (!error) list_push_front(include_directories, Include_Path::local(path));
-  else log("WARNING: Couldn't resolve parent folder for the source file '%' due to a system error: %. "
-           "Build process will continue, but this may cause issues with include files lookup.",
-           file.path, error);
+  /*
+    Values point into the mapped file, unless these come from the cache.
+   */
+  Slice<String> include_values;
+
+  if (entry && entry->parsed && entry->file_id == file_id && entry->timestamp == timestamp) {
+    include_values = entry->values;
+  }
+  else {
+    mapping     = unwrap(map_file_into_memory(file));
+    file_mapped = true;
+
+    include_values = parse_include_values(arena, file, mapping);
+
+    if (entry) {
+      *entry = Scan_Entry { .key = entry->key, .file_id = file_id, .timestamp = timestamp, .watched = entry->watched };
+      entry->parsed = store_paths(entry->values, include_values);
+    }
+  }
+
+  /*
+    Entry is checked for this build, the watcher reports changes that happen from now on.
+   */
+  if (entry && entry->parsed) entry->trust_generation = scan_cache.trust_generation;
 
   Chain_Status chain_status = Chain_Status::Unchanged;
 
-  auto mapping = unwrap(map_file_into_memory(file));
-  defer { unmap_file(mapping); };
+  Slice<File_Path> resolved_paths;
+
+  if (trusted && entry->resolved_all && entry->directories_key == directories_key && entry->layout_generation == scan_cache.layout_generation) {
+    resolved_paths = entry->resolved;
+  }
+  else {
+    List<Include_Path> include_directories(arena, extra_include_directories);
+
+    auto [error, folder] = get_folder_path(arena, path);
+    if (!error) list_push_front(include_directories, Include_Path::local(folder));
+    else log("WARNING: Couldn't resolve parent folder for the source file '%' due to a system error: %. "
+             "Build process will continue, but this may cause issues with include files lookup.",
+             path, error);
 
-  const auto try_resolve_include_path = [&] (Memory_Arena &arena, File_Path path) {
-    for (auto &prefix: include_directories) {
+    const auto try_resolve_include_path = [&] (Memory_Arena &arena, File_Path path) {
       /*
-        Perhaps at some point later checking system paths for changes would be helpful, but it this point it could
-        be a really deep rabbit hole with lots of issues (e.g perf, any form of macros that this tool doesn't support
-        at this point).
+        Absolute includes are taken as-is, e.g units of unity builds include their members by absolute paths.
        */
-      if (prefix.kind == Include_Path::System) continue;
+      if (!is_empty(path) && is_absolute_path(path)) {
+        auto full_path = copy_string(arena, path);
+        return check_file_exists(full_path).or_default(false) ? full_path : File_Path {};
+      }
+
+      for (auto &prefix: include_directories) {
+        /*
+          Perhaps at some point later checking system paths for changes would be helpful, but it this point it could
+          be a really deep rabbit hole with lots of issues (e.g perf, any form of macros that this tool doesn't support
+          at this point).
+         */
+        if (prefix.kind == Include_Path::System) continue;
       
-      auto full_path = make_file_path(arena, prefix.value, path);
+        auto full_path = make_file_path(arena, prefix.value, path);
 
-      auto [error, exists] = check_file_exists(full_path);
-      if (!exists) continue;
-      else if (error) {
-        log("WARNING: System error occured while checking file %\n", error.value);
-        continue;
+        auto [error, exists] = check_file_exists(full_path);
+        if (!exists) continue;
+        else if (error) {
+          log("WARNING: System error occured while checking file %\n", error.value);
+          continue;
+        }
+
+        return full_path;
       }
 
-      return full_path;
-    }
+      return File_Path {};
+    };
 
-    return File_Path {};
-  };
+    auto paths = reserve_array<File_Path>(arena, include_values.count);
 
-  auto iterator = Dependency_Iterator(file, mapping);
-  while (auto include_value = get_next_include_value(iterator)) {
-    auto local = arena;
+    bool resolved_all = true;
+    for (usize idx = 0; idx < include_values.count; idx++) {
+      auto &include_value = include_values[idx];
+
+      paths[idx] = try_resolve_include_path(arena, include_value);
+      if (paths[idx]) continue;
+
+      auto local = arena;
 
-    auto resolved_path = try_resolve_include_path(local, include_value.value);
-    if (!resolved_path) {
       String_Builder builder { local };
-      builder.add(local, "Couldn't resolve the include file ", include_value.value, " from file ", file.path, " the following paths were checked:\n");
-      for (auto &path: include_directories)
-        if (path.kind == Include_Path::Local)
-          builder.add(local, "  - ", path.value, "\n");      
+      builder.add(local, "Couldn't resolve the include file ", include_value, " from file ", path, " the following paths were checked:\n");
+      for (auto &directory: include_directories)
+        if (directory.kind == Include_Path::Local)
+          builder.add(local, "  - ", directory.value, "\n");      
 
       log("\n%\n", build_string(local, builder));
+
       chain_status = Chain_Status::Updated;
-      continue;
+      resolved_all = false;
     }
 
-    auto [open_error, dependency_file] = open_file(resolved_path);
-    if (open_error) {
-      log("WARNING: Couldn't open included header file for scanning due to a system error: %.", open_error.value);
-      chain_status = Chain_Status::Updated;
-      continue;
+    resolved_paths = Slice(paths.values, paths.count);
+
+    /*
+      Resolution is reused only while the watcher vouches that no files were added or removed, failed lookups aren't
+      cached at all, these are reported on every build.
+     */
+    if (entry && entry->parsed && resolved_all && store_paths(entry->resolved, resolved_paths)) {
+      entry->resolved_all      = true;
+      entry->directories_key   = directories_key;
+      entry->layout_generation = scan_cache.layout_generation;
     }
+  }
 
-    defer { close_file(dependency_file); };
+  for (auto &resolved_path: resolved_paths) {
+    if (!resolved_path) continue;
 
-    auto chain_scan_result = scan_dependency_chain(local, scanner, extra_include_directories, dependency_file, true);
+    auto local = arena;
+
+    auto chain_scan_result = scan_dependency_chain(local, scanner, extra_include_directories, directories_key, resolved_path, nullptr, true);
     fin_ensure(chain_scan_result != Chain_Status::Unchecked);
 
     if (chain_scan_result == Chain_Status::Updated) chain_status = Chain_Status::Updated;
@@ -452,8 +801,6 @@ static Chain_Status scan_dependency_chain (Memory_Arena &arena, Chain_Scanner &s
 
   if (!is_included_file) return chain_status; // That's all that we need to do for a translation unit
 
-  auto timestamp = unwrap(get_last_update_timestamp(file));
-
   /*
     If the upstream chain hasn't been updated, we must also consider the current file for any changes.
    */
@@ -466,7 +813,7 @@ static Chain_Status scan_dependency_chain (Memory_Arena &arena, Chain_Scanner &s
     if (existing_entry_found) {
       auto record_timestamp = scanner.registry.records.dependency_records[index].timestamp;
       if (timestamp != record_timestamp) {
-        if (tracing_enabled_opt) log("Included file '%' has newer timestamp\n", file.path);
+        if (tracing_enabled_opt) log("Included file '%' has newer timestamp\n", path);
         chain_status = Chain_Status::Updated;
       }
     }
@@ -485,5 +832,11 @@ static Chain_Status scan_dependency_chain (Memory_Arena &arena, Chain_Scanner &s
 }
 
 bool scan_dependency_chain (Memory_Arena &arena, Chain_Scanner &scanner, const List<Include_Path> &extra_include_directories, const File &file) {
-  return scan_dependency_chain (arena, scanner, extra_include_directories, file, false) == Chain_Status::Updated;
+  auto directories_key = get_directories_key(extra_include_directories);
+  return scan_dependency_chain(arena, scanner, extra_include_directories, directories_key, file.path, &file, false) == Chain_Status::Updated;
+}
+
+bool scan_header_chain (Memory_Arena &arena, Chain_Scanner &scanner, const List<Include_Path> &extra_include_directories, const File &file) {
+  auto directories_key = get_directories_key(extra_include_directories);
+  return scan_dependency_chain(arena, scanner, extra_include_directories, directories_key, file.path, &file, true) == Chain_Status::Updated;
 }
@@ -7,6 +7,40 @@
 #include "cbuild.hpp"
 #include "registry.hpp"
 
+struct Dependency_Iterator {
+  const File   &file;
+  File_Mapping  mapping;
+  const char   *cursor;
+  const char   *end;
+
+  constexpr Dependency_Iterator (const File &_file, File_Mapping _mapping)
+    : file    { _file },
+      mapping { _mapping },
+      cursor  { mapping.memory },
+      end     { mapping.memory + mapping.size }
+  {}
+
+  constexpr auto & operator += (usize by) {
+    this->cursor += by;
+    return *this;
+  }
+
+  constexpr auto & operator ++ (int) {
+    this->cursor++;
+    return *this;
+  }
+};
+
+enum struct Parse_Error {
+  Invalid_Value
+};
+
+/*
+  Iterates over all user-defined #include directives in the mapped source file retrieving the provided value as-is.
+  Resolution of the retrieved file path is left for the caller.
+ */
+Option<String> get_next_include_value (Dependency_Iterator &iterator);
+
 enum struct Chain_Status: u32 {
   Unchecked,
   Checking,
@@ -14,6 +48,40 @@ enum struct Chain_Status: u32 {
   Unchanged,
 };
 
+/*
+  Paths on Win32 are case-insensitive and could use either kind of separators. Trailing separators are ignored.
+ */
+bool is_same_path (String left, String right);
+
+/*
+  Checks if the path is inside the folder, at any depth.
+ */
+bool is_under_folder (File_Path folder, File_Path path);
+
+/*
+  Scanned files are remembered between builds of the same process, which pays off for the daemon and the watcher, files
+  that haven't changed since the previous build aren't parsed again.
+ */
+void enable_scan_cache ();
+
+/*
+  Watcher reports every change under its root, thus files under it that weren't reported as changed are taken as they
+  were, without opening them, along with the locations of their includes. Once trusted, all changes under the root must
+  be reported with mark_scan_cache_changed.
+ */
+void trust_scan_cache (Memory_Arena &arena, File_Path watched_root);
+
+/*
+  Reports a change of the file's content. Added, removed or renamed files, as well as lost changes, are reported with
+  an empty path, after which every file is checked again and includes are looked up again.
+ */
+void mark_scan_cache_changed (Memory_Arena &arena, File_Path path);
+
+/*
+  Called once per build, before any file is scanned. Cache is sized from the project's files count.
+ */
+void prepare_scan_cache (usize files_count);
+
 struct Chain_Scanner {
   Registry   &registry;
   Update_Set &update_set;
@@ -34,3 +102,11 @@ struct Chain_Scanner {
   Returns true if the chain has any updates, false otherwise.
  */
 bool scan_dependency_chain (Memory_Arena &arena, Chain_Scanner &scanner, const List<Include_Path> &extra_include_directories, const File &file);
+
+/*
+  Scans a header that is compiled on its own, e.g a precompiled header. Unlike translation units, the header is tracked
+  as a dependency, thus changes of the header itself are detected along with changes of its includes.
+
+  Returns true if the header or its chain has any updates, false otherwise.
+ */
+bool scan_header_chain (Memory_Arena &arena, Chain_Scanner &scanner, const List<Include_Path> &extra_include_directories, const File &file);
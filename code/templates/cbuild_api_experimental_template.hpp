@@ -26,6 +26,7 @@ typedef struct Project Project;
 typedef struct Project_Ref Project_Ref;
 typedef struct Target Target;
 typedef struct Arguments Arguments;
+typedef struct Toolchain_Configuration Toolchain_Configuration;
 
 enum Hook_Type {
   Hook_Type_After_Target_Linked,
@@ -33,6 +34,17 @@ enum Hook_Type {
 
 typedef void (*Hook_Func) (const Project *project, const Target *target, const Arguments *args, Hook_Type type) CBUILD_NO_EXCEPT;
 
+enum Linker_Type {
+  Linker_Type_Toolchain, // linker of the project's toolchain
+  Linker_Type_MSVC,      // link.exe
+  Linker_Type_LLD,       // lld-link.exe
+};
+
+enum Debug_Info_Mode {
+  Debug_Info_Mode_Default,   // as configured by compiler and linker options
+  Debug_Info_Mode_Fast_Link, // debug info stays in object files, linker only references it
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -51,6 +63,59 @@ CBUILD_EXPERIMENTAL_API const char * find_executable (Project *project, const ch
 
 CBUILD_EXPERIMENTAL_API int run_system_command (Project *project, const char *command_name, char *buffer, unsigned int buffer_size, unsigned int *written_size) CBUILD_NO_EXCEPT;
 
+CBUILD_EXPERIMENTAL_API void overwrite_toolchain (Project *project, Toolchain_Configuration toolchain) CBUILD_NO_EXCEPT;
+
+/*
+  Compiles target's files in batches of up to 'files_per_unit' files, each batch as a single translation unit, which
+  cuts the time spent on parsing the same headers over and over. Files of a batch share the translation unit, thus
+  these must not define conflicting internal names. Files that change frequently are compiled on their own.
+  Passing 0 or 1 disables unity build for the target.
+ */
+CBUILD_EXPERIMENTAL_API void enable_unity_build (Target *target, unsigned int files_per_unit) CBUILD_NO_EXCEPT;
+
+/*
+  Compiles the header once, before other files of the target, and makes it available to each C++ file of the target,
+  as if the file included it first. The header is rebuilt when it or any of its includes change, which also rebuilds
+  target's C++ files.
+ */
+CBUILD_EXPERIMENTAL_API void set_precompiled_header (Target *target, const char *header) CBUILD_NO_EXCEPT;
+
+/*
+  Static libraries of the project are written by cbuild, instead of running the archiver for each library. Archiver
+  options are not used in this case. Libraries that cbuild can't handle, e.g with LTO objects, are still created by
+  the archiver.
+ */
+CBUILD_EXPERIMENTAL_API void enable_builtin_archiver (Project *project) CBUILD_NO_EXCEPT;
+
+/*
+  Static library is created as a thin archive, which only references target's object files instead of copying them.
+  Such library is usable only while the objects are in place, thus it's meant for libraries consumed by other targets
+  of the project. Ignored for installed targets and if the linker doesn't read thin archives, e.g MSVC's link.exe.
+ */
+CBUILD_EXPERIMENTAL_API void enable_thin_archive (Target *target) CBUILD_NO_EXCEPT;
+
+/*
+  Links project's shared libraries and executables with the given linker instead of the toolchain's one. LLD links
+  with as many threads as there are idle builders at the time, thus the last links of the build, which usually run on
+  their own, use the whole machine.
+ */
+CBUILD_EXPERIMENTAL_API void set_linker (Project *project, Linker_Type linker) CBUILD_NO_EXCEPT;
+
+/*
+  Fast link mode cuts the time debug links spend on merging debug info. MSVC's linker writes a PDB that references
+  debug info in object files, i.e /DEBUG:FASTLINK, which is usable only while objects are in place. With LLD, files are
+  compiled with precomputed type hashes, which LLD uses to merge types, i.e /DEBUG:GHASH. Target's files should be
+  compiled with debug info, e.g /Z7 or /Zi.
+ */
+CBUILD_EXPERIMENTAL_API void set_debug_info_mode (Target *target, Debug_Info_Mode mode) CBUILD_NO_EXCEPT;
+
+/*
+  Compiles target's files for link-time optimization, which happens when the target is linked. With LLVM toolchains
+  'thin' enables ThinLTO, which results are cached under the build location and reused by following links, so only
+  modules affected by the changes are optimized again. MSVC toolchains use incremental LTCG instead.
+ */
+CBUILD_EXPERIMENTAL_API void enable_lto (Target *target, bool thin) CBUILD_NO_EXCEPT;
+
 #ifdef __cplusplus
 }
 #endif
@@ -6,6 +6,13 @@
 
 #include "cbuild_api.hpp"
 
+/*
+  Toolchain and SDK lookup results are persisted in the cache file, so that subsequent runs could skip the discovery.
+  Loading drops records that are no longer valid, saving writes the file only if anything has been updated.
+ */
+void load_toolchain_cache (File_Path cache_file_path);
+void save_toolchain_cache ();
+
 Option<Toolchain_Configuration> lookup_toolchain_by_type (Memory_Arena &arena, Toolchain_Type type);
 
 Option<Toolchain_Configuration> discover_toolchain (Memory_Arena &arena);
@@ -3,6 +3,8 @@
 #include <shellapi.h>
 
 #include "anyfin/base.hpp"
+#include "anyfin/file_system.hpp"
+#include "anyfin/hash.hpp"
 #include "anyfin/meta.hpp"
 #include "anyfin/option.hpp"
 #include "anyfin/result.hpp"
@@ -15,6 +17,150 @@
 #include "cbuild_api.hpp"
 #include "toolchain.hpp"
 
+/*
+  Toolchain discovery spawns vswhere.exe and walks MSVC and Windows Kits folders, which takes a few hundred milliseconds
+  on every run, while the result almost never changes. Resolved values are persisted in the cache file, each along with
+  the path that fingerprints it. If the last write time of that path doesn't match the stored one, i.e some version
+  was installed or removed, the record is dropped and the value is resolved the usual way.
+ */
+struct Toolchain_Cache {
+  constexpr static u32 Version     = 1;
+  constexpr static u32 Max_Records = 16;
+
+  enum struct Kind: u32 {
+    Empty,
+    MSVC_Path,
+    Windows_Kits_Path,
+    Windows_SDK_Version,
+    Executable,
+  };
+
+  struct Record {
+    Kind kind;
+    u32  reserved;
+
+    /*
+      Distinguishes records of the same kind, e.g executables are keyed by their name and the PATH they were found in.
+     */
+    u64 key;
+
+    u64  fingerprint;
+    char fingerprint_path[MAX_PATH];
+
+    char value[MAX_PATH];
+  };
+
+  u32 version;
+  u32 records_count;
+
+  Record records[Max_Records];
+};
+
+static Toolchain_Cache toolchain_cache;
+static File_Path       toolchain_cache_file_path;
+static bool            toolchain_cache_updated;
+
+static u64 get_resource_timestamp (const char *path) {
+  WIN32_FILE_ATTRIBUTE_DATA data;
+  if (!GetFileAttributesExA(path, GetFileExInfoStandard, &data)) return 0;
+
+  return (static_cast<u64>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+}
+
+void load_toolchain_cache (File_Path cache_file_path) {
+  toolchain_cache_file_path = cache_file_path;
+  toolchain_cache_updated   = false;
+  toolchain_cache           = {};
+
+  auto [open_error, file] = open_file(cache_file_path);
+  if (open_error) return;
+  defer { close_file(file); };
+
+  if (get_file_size(file).or_default(0) != sizeof(Toolchain_Cache)) return;
+
+  /*
+    Reading straight into the global to avoid putting ~8KB on the stack.
+   */
+  if (read_bytes_into_buffer(file, reinterpret_cast<u8 *>(&toolchain_cache), sizeof(Toolchain_Cache)).is_error() ||
+      toolchain_cache.version != Toolchain_Cache::Version ||
+      toolchain_cache.records_count > Toolchain_Cache::Max_Records) {
+    toolchain_cache = {};
+    return;
+  }
+
+  u32 valid_count = 0;
+  for (u32 idx = 0; idx < toolchain_cache.records_count; idx++) {
+    auto &record = toolchain_cache.records[idx];
+
+    auto timestamp = get_resource_timestamp(record.fingerprint_path);
+    if (timestamp == 0 || timestamp != record.fingerprint) {
+      toolchain_cache_updated = true;
+      continue;
+    }
+
+    toolchain_cache.records[valid_count++] = record;
+  }
+
+  toolchain_cache.records_count = valid_count;
+}
+
+void save_toolchain_cache () {
+  using enum File_System_Flags;
+
+  if (!toolchain_cache_updated || !toolchain_cache_file_path) return;
+
+  toolchain_cache.version = Toolchain_Cache::Version;
+
+  auto [open_error, file] = open_file(toolchain_cache_file_path, Write_Access | Always_New);
+  if (open_error) {
+    log("WARNING: Couldn't persist toolchain cache at % due to an error: %\n", toolchain_cache_file_path, open_error.value);
+    return;
+  }
+
+  auto result = write_bytes_to_file(file, reinterpret_cast<u8 *>(&toolchain_cache), sizeof(Toolchain_Cache));
+  close_file(file);
+
+  if (result.is_error()) {
+    log("WARNING: Couldn't persist toolchain cache at % due to an error: %\n", toolchain_cache_file_path, result.error.value);
+    delete_file(toolchain_cache_file_path);
+    return;
+  }
+
+  toolchain_cache_updated = false;
+}
+
+static Option<String> lookup_cached_value (Memory_Arena &arena, Toolchain_Cache::Kind kind, u64 key = 0) {
+  for (u32 idx = 0; idx < toolchain_cache.records_count; idx++) {
+    auto &record = toolchain_cache.records[idx];
+    if (record.kind == kind && record.key == key) return copy_string(arena, record.value);
+  }
+
+  return opt_none;
+}
+
+static void store_cached_value (Toolchain_Cache::Kind kind, u64 key, String value, String fingerprint_path) {
+  if (toolchain_cache.records_count == Toolchain_Cache::Max_Records) return;
+  if (value.length >= MAX_PATH || fingerprint_path.length >= MAX_PATH) return;
+
+  auto &record = toolchain_cache.records[toolchain_cache.records_count];
+  record = {};
+
+  copy_memory(record.fingerprint_path, fingerprint_path.value, fingerprint_path.length);
+  copy_memory(record.value,            value.value,            value.length);
+
+  /*
+    A value that can't be fingerprinted would never be invalidated, thus it's better not to cache it at all.
+   */
+  record.fingerprint = get_resource_timestamp(record.fingerprint_path);
+  if (record.fingerprint == 0) return;
+
+  record.kind = kind;
+  record.key  = key;
+
+  toolchain_cache.records_count += 1;
+  toolchain_cache_updated        = true;
+}
+
 static File_Path get_program_files_path (Memory_Arena &arena) {
   auto [error, value] = get_env_var(arena, "ProgramFiles(x86)");
   if (error) panic("Couldn't get the environment variable value for the key 'ProgramFiles(x86)' due to a system error: %\n", error.value);
@@ -50,8 +196,15 @@ static void split_version (const char* version, int* major, int* minor, int* pat
 // Without linking with CRT, local static variables are not supported
 static File_Path msvc_path;
 static String get_msvc_installation_path (Memory_Arena &arena) {
+  using enum Toolchain_Cache::Kind;
+
   if (msvc_path) return msvc_path;
 
+  if (auto [found, cached_path] = lookup_cached_value(arena, MSVC_Path); found) {
+    msvc_path = cached_path;
+    return msvc_path;
+  }
+
   auto program_files_path = get_program_files_path(arena);
 
   auto command = format_string(arena, R"("%\Microsoft Visual Studio\Installer\vswhere.exe" -property installationPath)", program_files_path);
@@ -96,15 +249,35 @@ static String get_msvc_installation_path (Memory_Arena &arena) {
   if (auto result = check_directory_exists(msvc_path); result.is_error() || !result.value)
     panic("Resolved MSVC path doesn't exist: %. If this folder does exists, this is likely a bug in CBuild.\n", msvc_path);
 
+  /*
+    Installing a new MSVC version adds a folder next to the current one, updating the timestamp of the parent folder.
+   */
+  store_cached_value(MSVC_Path, 0, msvc_path, concat_string(arena, vs_path, "\\VC\\Tools\\MSVC"));
+
   return msvc_path;
 }
 
 static Option<Toolchain_Configuration> load_llvm_toolchain (Memory_Arena &arena, bool force_clang = false) {
+  /*
+    Lookup result depends on the PATH, which makes it a part of the cache key.
+   */
+  auto [env_error, path_env_var] = get_env_var(arena, "PATH");
+  auto path_hash = hash_string(env_error ? String() : path_env_var.or_default({}));
+
   const auto get_executable = [&] (const char *name) -> String {
+    using enum Toolchain_Cache::Kind;
+
+    auto key = hash_string(name, path_hash);
+    if (auto [found, cached_path] = lookup_cached_value(arena, Executable, key); found) return cached_path;
+
     char buffer[MAX_PATH];
     auto status = reinterpret_cast<usize>(FindExecutable(name, NULL, buffer));
     if (status <= 32) panic("Executable % not found, please make sure it's added to the system's PATH\n", name);
-    return copy_string(arena, buffer);
+
+    auto executable_path = copy_string(arena, buffer);
+    store_cached_value(Executable, key, executable_path, executable_path);
+
+    return executable_path;
   };
   
   return Toolchain_Configuration {
@@ -207,6 +380,20 @@ static Windows_SDK find_windows_sdk (Memory_Arena &arena) {
          "Please report this issue.\n");
   };
 
+  using enum Toolchain_Cache::Kind;
+
+  {
+    auto [kits_found,    cached_kits]    = lookup_cached_value(arena, Windows_Kits_Path);
+    auto [version_found, cached_version] = lookup_cached_value(arena, Windows_SDK_Version);
+
+    if (kits_found && version_found) {
+      return Windows_SDK {
+        .base_path = move(cached_kits),
+        .version   = move(cached_version),
+      };
+    }
+  }
+
   File_Path windows_kits;
   {
     auto [found_in_registry, path] = lookup_windows_kits_from_registry(arena);
@@ -252,9 +439,18 @@ static Windows_SDK find_windows_sdk (Memory_Arena &arena) {
     }
   } while (FindNextFile(search_handle, &data));
 
+  auto sdk_version = concat_string(arena, "10.", max_minor, ".", max_revision, ".", max_build);
+
+  /*
+    Similar to MSVC, installing a newer SDK adds a new versioned folder under Include.
+   */
+  auto include_folder_path = concat_string(arena, windows_kits, "\\Include");
+  store_cached_value(Windows_Kits_Path,   0, windows_kits, include_folder_path);
+  store_cached_value(Windows_SDK_Version, 0, sdk_version,  include_folder_path);
+
   return Windows_SDK {
     .base_path = move(windows_kits),
-    .version   = concat_string(arena, "10.", max_minor, ".", max_revision, ".", max_build),
+    .version   = sdk_version,
   };
 }
 
@@ -0,0 +1,302 @@
+#include "anyfin/base.hpp"
+#include "anyfin/array.hpp"
+#include "anyfin/defer.hpp"
+#include "anyfin/format.hpp"
+#include "anyfin/hash.hpp"
+#include "anyfin/memory.hpp"
+#include "anyfin/string_builder.hpp"
+
+#include "unity_build.hpp"
+
+/*
+  State file is the header followed by a record per member, keys are hashes of members' paths. It's only a hint for the
+  next build, if it's lost units are rebalanced from scratch.
+ */
+struct Unity_Header {
+  u32 version;
+  u32 records_count;
+};
+
+struct Unity_Record {
+  u64 key;
+  u64 timestamp;
+  u32 unit;
+  u32 heat;
+};
+
+constexpr u32 unity_state_version = 1;
+
+/*
+  Unit index of members compiled on their own and of members that are yet to be placed into a unit.
+ */
+constexpr u32 own_unit   = static_cast<u32>(-1);
+constexpr u32 unassigned = static_cast<u32>(-2);
+
+/*
+  Each change of a member heats it up, while changes of other members of the target cool it down. Members are evicted
+  once they are hot enough, i.e changed in a couple of recent builds, and are placed back only when they cool down
+  completely, thus a single edit doesn't move files around.
+ */
+constexpr u32 heat_per_change = 2;
+constexpr u32 eviction_heat   = 4;
+constexpr u32 max_heat        = 8;
+
+struct Unity_Member {
+  const File_Path *path;
+
+  u64  key;
+  u64  size;
+  u64  timestamp;
+  u32  unit;
+  u32  heat;
+  bool is_cpp;
+  bool changed;
+};
+
+struct Unity_Unit {
+  u64  size;
+  u32  count;
+  bool is_cpp;
+};
+
+File_Path get_unity_folder_path (Memory_Arena &arena, const Target &target) {
+  return make_file_path(arena, target.project.build_location_path, "unity", target.name);
+}
+
+static Array<Unity_Record> load_unity_state (Memory_Arena &arena, File_Path path, usize members_count) {
+  Slice<Unity_Record> records;
+
+  auto [open_error, file] = open_file(path);
+  if (!open_error) {
+    defer { close_file(file); };
+
+    auto [read_error, content] = get_file_content(arena, file);
+    if (!read_error && content.count >= sizeof(Unity_Header)) {
+      auto header = reinterpret_cast<const Unity_Header *>(content.values);
+
+      auto expected_size = sizeof(Unity_Header) + usize(header->records_count) * sizeof(Unity_Record);
+      if (header->version == unity_state_version && content.count == expected_size) {
+        records = Slice(reinterpret_cast<Unity_Record *>(content.values + sizeof(Unity_Header)), header->records_count);
+      }
+    }
+  }
+
+  usize capacity = (records.count + members_count) * 2;
+  capacity = align_forward_to_pow_2(capacity < 64 ? 64 : capacity);
+
+  auto table = reserve_array<Unity_Record>(arena, capacity);
+  zero_memory(table.values, table.count);
+
+  for (auto &record: records) {
+    if (record.key == 0) continue;
+    table[find_table_slot(table, record.key)] = record;
+  }
+
+  return table;
+}
+
+static void save_unity_state (Memory_Arena &arena, File_Path path, const Array<Unity_Member> &members) {
+  using enum File_System_Flags;
+
+  auto content = reserve_array<u8>(arena, sizeof(Unity_Header) + members.count * sizeof(Unity_Record));
+
+  auto header  = reinterpret_cast<Unity_Header *>(content.values);
+  auto records = reinterpret_cast<Unity_Record *>(content.values + sizeof(Unity_Header));
+
+  *header = Unity_Header { .version = unity_state_version, .records_count = static_cast<u32>(members.count) };
+
+  for (usize idx = 0; idx < members.count; idx++) {
+    auto &member = members[idx];
+    records[idx] = Unity_Record { .key = member.key, .timestamp = member.timestamp, .unit = member.unit, .heat = member.heat };
+  }
+
+  auto [open_error, file] = open_file(path, Write_Access | Always_New);
+  if (open_error) {
+    log("WARNING: Couldn't save unity build state into % due to an error: %\n", path, open_error.value);
+    return;
+  }
+
+  defer { close_file(file); };
+
+  if (auto result = write_bytes_to_file(file, content.values, content.count); result.is_error())
+    log("WARNING: Couldn't save unity build state into % due to an error: %\n", path, result.error.value);
+}
+
+/*
+  Units are rewritten only when their members change, otherwise the new timestamp would trigger the unit's rebuild.
+ */
+static void write_unit_file (Memory_Arena &arena, File_Path path, String content) {
+  using enum File_System_Flags;
+
+  if (has_same_content(arena, path, content)) return;
+
+  auto [open_error, file] = open_file(path, Write_Access | Always_New);
+  if (open_error) panic("Couldn't create unity build file % due to an error: %\n", path, open_error.value);
+
+  defer { close_file(file); };
+
+  ensure(write_bytes_to_file(file, content));
+}
+
+/*
+  Picks the lightest unit of the same language that has room for another member. Units past the expected count are
+  opened only when all others are full, which could happen if some units are shared by both languages' members.
+ */
+static u32 find_unit_for_member (const Array<Unity_Unit> &units, u32 expected_units_count, u32 files_per_unit, bool is_cpp) {
+  u32 selected = own_unit;
+
+  for (u32 idx = 0; idx < units.count; idx++) {
+    auto &unit = units[idx];
+
+    if (unit.count && unit.is_cpp != is_cpp) continue;
+    if (unit.count >= files_per_unit)       continue;
+    if (idx >= expected_units_count && selected != own_unit) break;
+
+    if (selected == own_unit || unit.size < units[selected].size) selected = idx;
+  }
+
+  fin_ensure(selected != own_unit);
+
+  return selected;
+}
+
+void prepare_unity_units (Memory_Arena &arena, const Target &target, List<File_Path> &sources) {
+  using enum File_System_Flags;
+
+  const auto files_per_unit = target.unity.files_per_unit;
+  fin_ensure(files_per_unit > 1);
+
+  auto unity_folder = get_unity_folder_path(arena, target);
+  ensure(create_directory(unity_folder, Force));
+
+  auto state_file_path = make_file_path(arena, unity_folder, "__unity");
+  auto state = load_unity_state(arena, state_file_path, target.files.count);
+
+  auto members = reserve_array<Unity_Member>(arena, target.files.count);
+
+  bool target_changed = false;
+  u32  cpp_count      = 0;
+  u32  c_count        = 0;
+
+  for (usize idx = 0; auto &path: target.files) {
+    auto file = unwrap(open_file(path));
+    defer { close_file(file); };
+
+    auto &member = members[idx++];
+    member = Unity_Member {
+      .path      = &path,
+      .key       = make_table_key(hash_string(path)),
+      .size      = unwrap(get_file_size(file)),
+      .timestamp = unwrap(get_last_update_timestamp(file)),
+      .unit      = unassigned,
+      .is_cpp    = ends_with(path, "cpp"),
+    };
+
+    auto &record = state[find_table_slot(state, member.key)];
+    if (record.key) {
+      member.unit    = record.unit;
+      member.heat    = record.heat;
+      member.changed = record.timestamp != member.timestamp;
+    }
+
+    target_changed = target_changed || member.changed;
+  }
+
+  for (auto &member: members) {
+    if (member.changed) {
+      member.heat += heat_per_change;
+      if (member.heat > max_heat) member.heat = max_heat;
+    }
+    else if (target_changed && member.heat) {
+      member.heat -= 1;
+    }
+
+    if (member.heat >= eviction_heat) member.unit = own_unit;
+    else if (member.unit == own_unit && member.heat == 0) member.unit = unassigned;
+
+    if (member.unit == own_unit) continue;
+
+    if (member.is_cpp) cpp_count += 1;
+    else               c_count   += 1;
+  }
+
+  /*
+    There are never more units than pooled members, so the last resort of a single member per unit always has a slot.
+   */
+  const auto expected_units_count = (cpp_count + files_per_unit - 1) / files_per_unit + (c_count + files_per_unit - 1) / files_per_unit;
+
+  auto units = reserve_array<Unity_Unit>(arena, cpp_count + c_count);
+  zero_memory(units.values, units.count);
+
+  /*
+    Members keep their units, unless the unit is gone or is already full, e.g files were removed from the target, and
+    only the rest is distributed over the units.
+   */
+  for (auto &member: members) {
+    if (member.unit == own_unit || member.unit == unassigned) continue;
+
+    if (member.unit >= expected_units_count) {
+      member.unit = unassigned;
+      continue;
+    }
+
+    auto &unit = units[member.unit];
+    if ((unit.count && unit.is_cpp != member.is_cpp) || unit.count >= files_per_unit) {
+      member.unit = unassigned;
+      continue;
+    }
+
+    unit.is_cpp  = member.is_cpp;
+    unit.count  += 1;
+    unit.size   += member.size;
+  }
+
+  for (auto &member: members) {
+    if (member.unit != unassigned) continue;
+
+    member.unit = find_unit_for_member(units, expected_units_count, files_per_unit, member.is_cpp);
+
+    auto &unit = units[member.unit];
+    unit.is_cpp  = member.is_cpp;
+    unit.count  += 1;
+    unit.size   += member.size;
+  }
+
+  for (u32 unit_index = 0; unit_index < units.count; unit_index++) {
+    auto &unit = units[unit_index];
+    if (unit.count == 0) continue;
+
+    auto unit_path = make_file_path(arena, unity_folder, format_string(arena, "unity_%.%", unit_index, unit.is_cpp ? "cpp" : "c"));
+
+    auto local = arena;
+
+    String_Builder builder { local };
+    builder += "/*\n  Generated by cbuild for the unity build of the target, changes are overwritten.\n */\n\n";
+
+    for (auto &member: members) {
+      if (member.unit != unit_index) continue;
+      builder.add(local, "#include \"", *member.path, "\"\n");
+    }
+
+    write_unit_file(local, unit_path, build_string(local, builder));
+
+    list_push(sources, move(unit_path));
+  }
+
+  for (auto &member: members) {
+    if (member.unit == own_unit) list_push_copy(sources, *member.path);
+  }
+
+  /*
+    Units that are no longer used are removed, otherwise these would be picked up by the registry maintenance.
+   */
+  const String extensions [] { ".cpp", ".c" };
+  for (auto extension: extensions) {
+    for_each_file(unity_folder, extension, false, [&] (File_Path path) {
+      if (!sources.contains(path)) delete_file(path);
+      return true;
+    });
+  }
+
+  save_unity_state(arena, state_file_path, members);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "anyfin/base.hpp"
+#include "anyfin/arena.hpp"
+#include "anyfin/file_system.hpp"
+#include "anyfin/list.hpp"
+
+#include "cbuild_api.hpp"
+
+/*
+  Unity build compiles batches of the target's files as single translation units. Each unit is a generated file which
+  includes its members, thus changes of the members are tracked by the registry as changes of the unit's dependencies.
+
+  Members stay in the same units between builds, so that adding or removing a file regenerates only the unit it belongs
+  to, and units are rewritten only when their content changes. Files that keep changing between builds are taken out of
+  the units and compiled on their own, until they settle down.
+ */
+
+File_Path get_unity_folder_path (Memory_Arena &arena, const Target &target);
+
+/*
+  Generates target's units, pushing files that should be compiled instead of the target's files into 'sources'.
+ */
+void prepare_unity_units (Memory_Arena &arena, const Target &target, List<File_Path> &sources);
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "anyfin/arena.hpp"
+
+#include "cbuild.hpp"
+#include "cbuild_api.hpp"
+
+/*
+  Invoked by the watcher for every batch of changes, expected to build the project and return the exit code.
+ */
+using Watch_Build_Handler = u32 (*) (Memory_Arena &arena, void *context);
+
+/*
+  Builds the project, then keeps watching the project's tree for changes in the folders of target files, include paths,
+  or any header file, rebuilding the project once changes settle down. Stops if the project's configuration changes,
+  since it can't be reloaded in place.
+ */
+u32 run_watch (Memory_Arena &arena, const Project &project, Watch_Build_Handler handler, void *context);
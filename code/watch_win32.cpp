@@ -0,0 +1,227 @@
+
+#include "anyfin/win32.hpp"
+
+#include "anyfin/base.hpp"
+#include "anyfin/arena.hpp"
+#include "anyfin/defer.hpp"
+#include "anyfin/file_system.hpp"
+#include "anyfin/list.hpp"
+
+#include "cbuild.hpp"
+#include "cbuild_api.hpp"
+#include "scanner.hpp"
+#include "watch.hpp"
+#include "workspace.hpp"
+
+extern bool tracing_enabled_opt;
+
+/*
+  Editors tend to save files in several steps (e.g write to a temp file, then rename it), waiting for the tree to stay
+  quiet for a short while collapses all of that into a single rebuild.
+ */
+constexpr DWORD watch_debounce_millis = 150;
+
+constexpr usize watch_buffer_size = kilobytes(64);
+
+static bool is_header_file (String path) {
+  const String extensions [] { ".h", ".hh", ".hpp", ".hxx", ".inl", ".ipp" };
+
+  for (auto extension: extensions) {
+    if (path.length < extension.length) continue;
+
+    auto tail = String(path.value + path.length - extension.length, extension.length);
+    if (is_same_path(tail, extension)) return true;
+  }
+
+  return false;
+}
+
+static void add_watched_folder (List<File_Path> &folders, File_Path folder) {
+  if (folders.contains([&] (const File_Path &it) { return is_same_path(it, folder); })) return;
+  list_push_copy(folders, folder);
+}
+
+static List<File_Path> collect_watched_folders (Memory_Arena &arena, const Project &project) {
+  List<File_Path> folders { arena };
+
+  /*
+    Project configuration's folder is watched too, so that changes to the build file are noticed.
+   */
+  if (auto [error, folder] = get_folder_path(arena, get_loaded_configuration_path()); !error)
+    add_watched_folder(folders, folder);
+
+  for (auto &path: project.include_paths) {
+    if (path.kind == Include_Path::Local) add_watched_folder(folders, path.value);
+  }
+
+  for (auto &target: project.targets) {
+    for (auto &path: target.include_paths) {
+      if (path.kind == Include_Path::Local) add_watched_folder(folders, path.value);
+    }
+
+    for (auto &file_path: target.files) {
+      auto [error, folder] = get_folder_path(arena, file_path);
+      if (!error) add_watched_folder(folders, folder);
+    }
+  }
+
+  return folders;
+}
+
+static bool is_relevant_change (Memory_Arena &arena, const List<File_Path> &folders, File_Path root, String relative_path) {
+  /*
+    Build outputs are written into the tree, reacting to those would keep the watcher rebuilding forever.
+   */
+  if (relative_path.length >= 7 && is_same_path(String(relative_path.value, 7), ".cbuild")) return false;
+
+  if (is_header_file(relative_path)) return true;
+
+  auto full_path = make_file_path(arena, root, relative_path);
+
+  auto [error, folder] = get_folder_path(arena, full_path);
+  if (error) return false;
+
+  return folders.contains([&] (const File_Path &it) { return is_same_path(it, folder); });
+}
+
+u32 run_watch (Memory_Arena &arena, const Project &project, Watch_Build_Handler handler, void *context) {
+  auto folders = collect_watched_folders(arena, project);
+
+  if (tracing_enabled_opt) {
+    log("Watched folders:\n");
+    for (auto &folder: folders) log("  - %\n", folder);
+  }
+
+  auto root = project.project_root;
+
+  auto directory = CreateFileA(root.value, FILE_LIST_DIRECTORY,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+  if (directory == INVALID_HANDLE_VALUE) panic("Couldn't open project's folder % for watching due to an error: %\n", root, get_system_error());
+  defer { CloseHandle(directory); };
+
+  OVERLAPPED overlapped {};
+  overlapped.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+  if (!overlapped.hEvent) panic("Couldn't create an event for the watcher due to an error: %\n", get_system_error());
+  defer { CloseHandle(overlapped.hEvent); };
+
+  auto buffer = reserve<u8>(arena, watch_buffer_size, alignof(DWORD));
+  fin_ensure(buffer);
+
+  const DWORD notify_filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE;
+
+  /*
+    Read request stays queued while the project is being built, thus changes made during the build are picked up
+    right after it's over.
+   */
+  const auto queue_read = [&] {
+    ResetEvent(overlapped.hEvent);
+
+    if (!ReadDirectoryChangesW(directory, buffer, watch_buffer_size, TRUE, notify_filter, nullptr, &overlapped, nullptr))
+      panic("Couldn't watch project's folder for changes due to an error: %\n", get_system_error());
+  };
+
+  /*
+    Changes are watched before the initial build, so that nothing that happens after files are scanned goes unnoticed,
+    which is what allows the scanner to take unreported files as unchanged.
+   */
+  queue_read();
+  trust_scan_cache(arena, root);
+
+  bool read_pending    = true;
+  bool changes_pending = false;
+
+  /*
+    Initial build brings the project up to date, after which only changes trigger rebuilds.
+   */
+  {
+    auto local = arena;
+    handler(local, context);
+  }
+
+  log("Watching for changes...\n");
+
+  while (true) {
+    if (!read_pending) {
+      queue_read();
+      read_pending = true;
+    }
+
+    auto wait_status = WaitForSingleObject(overlapped.hEvent, changes_pending ? watch_debounce_millis : INFINITE);
+
+    if (wait_status == WAIT_OBJECT_0) {
+      read_pending = false;
+
+      DWORD bytes_transferred = 0;
+      if (!GetOverlappedResult(directory, &overlapped, &bytes_transferred, FALSE))
+        panic("Couldn't retrieve project's changes due to an error: %\n", get_system_error());
+
+      /*
+        Zero bytes means that the buffer overflowed and the changes were lost, rebuild to be on the safe side.
+       */
+      if (bytes_transferred == 0) {
+        mark_scan_cache_changed(arena, {});
+        changes_pending = true;
+        continue;
+      }
+
+      for (auto cursor = buffer; true;) {
+        auto local = arena;
+
+        auto info = reinterpret_cast<FILE_NOTIFY_INFORMATION *>(cursor);
+
+        auto name_length = static_cast<int>(info->FileNameLength / sizeof(WCHAR));
+        auto size        = WideCharToMultiByte(CP_UTF8, 0, info->FileName, name_length, nullptr, 0, nullptr, nullptr);
+
+        if (size > 0) {
+          auto name = reserve<char>(local, size + 1);
+          WideCharToMultiByte(CP_UTF8, 0, info->FileName, name_length, name, size, nullptr, nullptr);
+          name[size] = '\0';
+
+          auto relative_path = String(name, size);
+
+          /*
+            Scanner learns about every change, including irrelevant ones, since it can't tell which files these are.
+            It works with ANSI paths, names that are spelled differently in UTF-8 are reported as unknown changes.
+           */
+          bool is_ascii = true;
+          for (auto symbol: relative_path) is_ascii = is_ascii && static_cast<u8>(symbol) < 0x80;
+
+          if (info->Action == FILE_ACTION_MODIFIED && is_ascii) mark_scan_cache_changed(local, make_file_path(local, root, relative_path));
+          else                                                  mark_scan_cache_changed(local, {});
+
+          if (is_relevant_change(local, folders, root, relative_path)) {
+            if (tracing_enabled_opt) log("Change detected: %\n", relative_path);
+            changes_pending = true;
+          }
+        }
+        else {
+          mark_scan_cache_changed(local, {});
+        }
+
+        if (info->NextEntryOffset == 0) break;
+        cursor += info->NextEntryOffset;
+      }
+
+      continue;
+    }
+
+    if (wait_status != WAIT_TIMEOUT) panic("Watcher failed to wait for changes due to an error: %\n", get_system_error());
+
+    changes_pending = false;
+
+    if (is_project_configuration_outdated(arena)) {
+      log("Project configuration has changed, please restart the 'watch' command to load it\n");
+      return 1;
+    }
+
+    log("Changes detected, rebuilding the project\n");
+
+    {
+      auto local = arena;
+      handler(local, context);
+    }
+
+    log("Watching for changes...\n");
+  }
+}
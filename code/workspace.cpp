@@ -2,6 +2,9 @@
 #include "anyfin/base.hpp"
 
 #include "anyfin/arena.hpp"
+#include "anyfin/array.hpp"
+#include "anyfin/atomics.hpp"
+#include "anyfin/hash.hpp"
 #include "anyfin/option.hpp"
 #include "anyfin/result.hpp"
 #include "anyfin/string_builder.hpp"
@@ -9,13 +12,17 @@
 #include "anyfin/file_system.hpp"
 #include "anyfin/shared_library.hpp"
 #include "anyfin/commands.hpp"
+#include "anyfin/platform.hpp"
+#include "anyfin/threads.hpp"
 
 #include "templates/generated.h"
 
 #include "cbuild.hpp"
 #include "cbuild_api.hpp"
 #include "workspace.hpp"
+#include "build_trace.hpp"
 #include "toolchain.hpp"
+#include "scanner.hpp"
 
 extern bool   silence_logs_opt;
 extern bool   tracing_enabled_opt;
@@ -138,13 +145,13 @@ static inline void load_project_from_library (Project &project, Slice<Startup_Ar
   loader(&args, project);
 }
 
-static void build_project_configuration (Memory_Arena &arena, Project &project, const File &build_file) {
+static void build_project_configuration (Memory_Arena &arena, Project &project, const File &build_file, File_Path output_folder) {
   using enum File_System_Flags;
 
   auto &toolchain = project.toolchain;
 
   auto project_obj_file_name = concat_string(arena, project.name, ".", get_object_extension());
-  auto project_obj_file_path = make_file_path(arena, project.project_config_build_location, project_obj_file_name);
+  auto project_obj_file_path = make_file_path(arena, output_folder, project_obj_file_name);
 
   {
     auto local = arena;
@@ -193,8 +200,8 @@ static void build_project_configuration (Memory_Arena &arena, Project &project,
 
 #ifdef PLATFORM_WIN32
     {
-      auto cbuild_export_module_path = make_file_path(local, project.project_config_build_location, "cbuild.def");
-      auto cbuild_import_path        = make_file_path(local, project.project_config_build_location, "cbuild.lib");
+      auto cbuild_export_module_path = make_file_path(local, output_folder, "cbuild.def");
+      auto cbuild_import_path        = make_file_path(local, output_folder, "cbuild.lib");
 
       auto [open_error, export_module] = open_file(cbuild_export_module_path, Write_Access | Always_New);
       if (open_error) panic("Couldn't create export file to write data to due to an error: %.\n", open_error.value);
@@ -324,13 +331,125 @@ static Option<File_Path> discover_build_file (Memory_Arena &arena, const File_Pa
   return opt_none;
 }
 
+/*
+  Files are deleted in batches by a number of threads, while the tree is walked by the calling thread. Batches keep the
+  memory bounded regardless of the tree's size, build folders could have hundreds of thousands of objects.
+ */
+constexpr usize delete_batch_size = 16384;
+
+/*
+  Deleting a few files doesn't pay for starting threads.
+ */
+constexpr usize files_per_delete_thread = 256;
+
+struct Delete_Batch {
+  Array<File_Path> files;
+  Memory_Arena     paths;
+  usize            count;
+
+  ausize next;
+  au32   failed;
+};
+
+static void delete_batch_files (Delete_Batch *batch) {
+  while (true) {
+    auto idx = atomic_fetch_add(batch->next, 1);
+    if (idx >= batch->count) break;
+
+    if (delete_file(batch->files[idx]).is_error()) atomic_fetch_add(batch->failed, 1);
+  }
+}
+
+static void flush_delete_batch (Delete_Batch &batch, Array<Thread> &threads) {
+  atomic_store(batch.next, 0);
+
+  const usize wanted = batch.count / files_per_delete_thread;
+
+  usize spawned = 0;
+  for (; spawned < threads.count && spawned < wanted; spawned++) {
+    auto [error, thread] = spawn_thread(delete_batch_files, &batch);
+    if (error) break; // whatever is left is deleted by threads that did start
+
+    threads[spawned] = thread;
+  }
+
+  delete_batch_files(&batch);
+
+  for (usize idx = 0; idx < spawned; idx++) ensure(wait_for_thread(threads[idx]));
+
+  batch.count        = 0;
+  batch.paths.offset = 0;
+}
+
+/*
+  Directory is removed after all of its files are deleted in parallel, what's left is the folders' tree, which goes
+  quickly. Returns false if some of the content couldn't be removed.
+ */
+static bool delete_directory_parallel (Memory_Arena &arena, File_Path path) {
+  if (!check_directory_exists(path).or_default(false)) return true;
+
+  auto local = arena;
+
+  Delete_Batch batch {
+    .files = reserve_array<File_Path>(local, delete_batch_size),
+    .paths = make_sub_arena(local, delete_batch_size * 256),
+  };
+
+  auto cpu_count = get_logical_cpu_count();
+  auto threads   = reserve_array<Thread>(local, cpu_count > 1 ? cpu_count - 1 : 0);
+
+  auto walk_result = for_each_file(path, "", true, [&] (File_Path file_path) {
+    /*
+      Path buffer could run out before the batch does on deep trees.
+     */
+    if (batch.count == batch.files.count || batch.paths.offset + file_path.length + 1 > batch.paths.size)
+      flush_delete_batch(batch, threads);
+
+    batch.files[batch.count++] = copy_string(batch.paths, file_path);
+    return true;
+  });
+
+  flush_delete_batch(batch, threads);
+
+  if (walk_result.is_error() || atomic_load(batch.failed)) return false;
+
+  return delete_directory(path).is_ok();
+}
+
+/*
+  Folder is moved into the trash first, which is instant, thus an interrupted cleanup never leaves behind a partially
+  removed build folder, the trash with whatever was left in it is removed by the next cleanup.
+ */
+static void remove_folder (Memory_Arena &arena, File_Path trash_folder, File_Path path) {
+  if (!check_directory_exists(path).or_default(false)) return;
+
+  auto local = arena;
+
+  File_Path remove_path = path;
+
+  if (create_directory(trash_folder, File_System_Flags::Force).is_ok()) {
+    for (u32 idx = 0; idx < 64; idx++) {
+      auto trash_path = make_file_path(local, trash_folder, format_string(local, "%", idx));
+      if (check_resource_exists(trash_path).or_default(true)) continue;
+
+      if (rename_resource(path, trash_path).is_ok()) remove_path = trash_folder;
+      break;
+    }
+  }
+
+  if (!delete_directory_parallel(local, remove_path))
+    log("WARNING: Some files under '%' couldn't be removed, perhaps these are used by other processes\n", path);
+}
+
 void cleanup_workspace (Memory_Arena &arena, const File_Path &working_directory, Cleanup_Type type) {
   if (type == Cleanup_Type::Full) {
-    ensure(delete_directory(".cbuild"));
+    if (!delete_directory_parallel(arena, ".cbuild")) panic("Couldn't remove everything under '.cbuild', perhaps some files are used by other processes\n");
     log("Cleanup complete\n");
     return;
   }
 
+  auto trash_folder = make_file_path(arena, working_directory, ".cbuild", "__trash");
+
   auto path = resolve_project_output_dir_name(arena, working_directory);
 
   auto project_root_folder = make_file_path(arena, working_directory, ".cbuild", path);
@@ -338,36 +457,205 @@ void cleanup_workspace (Memory_Arena &arena, const File_Path &working_directory,
   auto config_folder       = make_file_path(arena, project_root_folder, "config");
 
   if (type == Cleanup_Type::Build || type == Cleanup_Type::Project) {
-    ensure(delete_directory(build_folder));
+    remove_folder(arena, trash_folder, build_folder);
     log("All produced files under '%' were removed\n", build_folder);
   }
 
   if (type == Cleanup_Type::Project) {
-    ensure(delete_directory(config_folder));
+    remove_folder(arena, trash_folder, config_folder);
     log("All produced files under '%' were removed\n", config_folder);
   }
 }
 
-struct Project_Registry {
-  constexpr static usize Version = 1;
-
-  struct Header {
-    u16 version;
-
-    // Version 1
-    u16 entries_count;
-  };
+/*
+  Index of the project configuration builds cached under the config folder. Each build lives in its own folder named
+  after the configuration key, which makes switching between branches, or toolchains, reuse an earlier build instead
+  of recompiling the configuration every time the build file changes back and forth.
+ */
+struct Config_Cache_Index {
+  constexpr static u16 Version     = 1;
+  constexpr static u16 Max_Entries = 4;
 
   struct Record {
-    char name[32];
-    u64  timestamp;
-    u64  hash;
+    u64 key;
+    u64 last_used; // Generation at which this configuration was loaded the last time.
   };
 
-  File         tag_file;
-  File_Mapping tag_file_mapping;
+  u16 version;
+  u16 entries_count;
+  u32 reserved;
+
+  u64 generation;
+
+  /*
+    Key of the configuration that was loaded the last time, i.e the one that current build outputs were produced with.
+   */
+  u64 active_key;
+
+  Record records[Max_Entries];
 };
 
+static Config_Cache_Index load_config_cache_index (File_Path index_file_path) {
+  Config_Cache_Index index {};
+
+  auto [open_error, file] = open_file(index_file_path);
+  if (open_error) return index;
+  defer { close_file(file); };
+
+  if (get_file_size(file).or_default(0) != sizeof(Config_Cache_Index)) return index;
+
+  Config_Cache_Index stored;
+  if (read_bytes_into_buffer(file, reinterpret_cast<u8 *>(&stored), sizeof(stored)).is_error()) return index;
+
+  if (stored.version != Config_Cache_Index::Version ||
+      stored.entries_count > Config_Cache_Index::Max_Entries) return index;
+
+  return stored;
+}
+
+static void save_config_cache_index (File_Path index_file_path, const Config_Cache_Index &index) {
+  using enum File_System_Flags;
+
+  auto [open_error, file] = open_file(index_file_path, Write_Access | Always_New);
+  if (open_error) {
+    log("WARNING: CBuild couldn't open the project's configuration index due to an error: %. "
+        "Full rebuild will happen on the next run.\n", open_error.value);
+    return;
+  }
+
+  auto write_result = write_bytes_to_file(file, reinterpret_cast<const u8 *>(&index), sizeof(index));
+  close_file(file);
+
+  if (write_result.is_error()) {
+    log("WARNING: CBuild couldn't update the project's configuration index due to an error: %. "
+        "Full rebuild will happen on the next run.\n", write_result.error.value);
+
+    /*
+      Partially written index is discarded on load, but it's cleaner to not leave it around.
+     */
+    delete_file(index_file_path);
+  }
+}
+
+/*
+  Folds the content of the configuration file and all local files it includes into the hash. Includes are resolved
+  relative to the including file's folder, which is how 'cbuild.h' and friends are referenced by the build file. An
+  include that couldn't be resolved contributes its name only, system includes are skipped by the iterator.
+ */
+static u64 hash_configuration_file (Memory_Arena &arena, List<u64> &visited, const File &file, u64 hash) {
+  auto file_id = unwrap(get_file_id(file));
+  if (visited.contains(file_id)) return hash;
+
+  list_push_copy(visited, file_id);
+
+  auto mapping = unwrap(map_file_into_memory(file));
+  defer { unmap_file(mapping); };
+
+  hash = hash_bytes(mapping.memory, mapping.size, hash);
+
+  auto [folder_error, folder_path] = get_folder_path(arena, file.path);
+  if (folder_error) return hash;
+
+  auto iterator = Dependency_Iterator(file, mapping);
+  while (auto include_value = get_next_include_value(iterator)) {
+    auto local = arena;
+
+    auto include_path = make_file_path(local, folder_path, include_value.value);
+
+    auto [open_error, include_file] = open_file(include_path);
+    if (open_error) {
+      hash = hash_string(include_value.value, hash);
+      continue;
+    }
+
+    hash = hash_configuration_file(local, visited, include_file, hash);
+    close_file(include_file);
+  }
+
+  return hash;
+}
+
+/*
+  The key identifies a configuration build: content of the build file with its local includes, the API that cbuild
+  exposes to it and the toolchain it's compiled with. Compiler's timestamp stands in for its version, which is much
+  cheaper than asking the compiler for it on every run.
+ */
+static u64 compute_configuration_key (Memory_Arena &arena, const Toolchain_Configuration &toolchain, const File &build_file) {
+  auto local = arena;
+
+  u64 hash = fnv_offset_basis;
+
+  {
+    auto visited_arena = make_sub_arena(local, kilobytes(8));
+    List<u64> visited { visited_arena };
+
+    hash = hash_configuration_file(local, visited, build_file, hash);
+  }
+
+  hash = hash_value(static_cast<u32>(TOOL_VERSION), hash);
+  hash = hash_value(api_version, hash);
+
+  /*
+    Configuration library imports cbuild's API from the executable by name, see build_project_configuration.
+   */
+  hash = hash_string(get_program_name(), hash);
+
+  hash = hash_value(toolchain.type, hash);
+
+  const char *tools [] { toolchain.c_compiler_path, toolchain.cpp_compiler_path, toolchain.linker_path };
+  for (auto tool_path: tools) {
+    if (!tool_path) continue;
+
+    hash = hash_string(tool_path, hash);
+
+    auto [open_error, tool_file] = open_file(tool_path);
+    if (open_error) continue;
+
+    hash = hash_value(get_last_update_timestamp(tool_file).or_default(0), hash);
+    close_file(tool_file);
+  }
+
+  return hash;
+}
+
+/*
+  Configuration that was loaded by this process, long-running commands use it to detect that the project has changed.
+  Toolchain is kept aside, since the project may overwrite it with something different from what the configuration was
+  built with.
+ */
+static struct {
+  File_Path               build_file_path;
+  Toolchain_Configuration toolchain;
+  u64                     key;
+} loaded_configuration;
+
+bool is_project_configuration_outdated (Memory_Arena &arena) {
+  auto local = arena;
+
+  auto [open_error, build_file] = open_file(loaded_configuration.build_file_path);
+  if (open_error) return true;
+  defer { close_file(build_file); };
+
+  return compute_configuration_key(local, loaded_configuration.toolchain, build_file) != loaded_configuration.key;
+}
+
+File_Path get_loaded_configuration_path () {
+  return loaded_configuration.build_file_path;
+}
+
+static String format_configuration_key (Memory_Arena &arena, u64 key) {
+  const char digits [] = "0123456789abcdef";
+
+  auto buffer = reserve<char>(arena, 17);
+  for (int idx = 15; idx >= 0; idx--) {
+    buffer[idx] = digits[key & 0xF];
+    key >>= 4;
+  }
+  buffer[16] = '\0';
+
+  return String(buffer, 16);
+}
+
 void update_cbuild_api_file (Memory_Arena &arena, File_Path working_directory) {
   auto project_directory_path = resolve_project_folder(arena, working_directory);
 
@@ -393,9 +681,20 @@ void update_cbuild_api_file (Memory_Arena &arena, File_Path working_directory) {
 void load_project (Memory_Arena &arena, Project &project, Slice<Startup_Argument> args) {
   using enum File_System_Flags;
 
+  auto load_start = begin_trace_span();
+  defer { record_trace_span(load_start, "config", "Load project"); };
+
   create_directory(project.cache_root);
   create_directory(project.project_config_build_location, Force);
 
+  /*
+    Saved once the project is loaded, since the configuration may pick a different toolchain and target architecture.
+   */
+  load_toolchain_cache(make_file_path(arena, project.cache_root, "__toolchain"));
+  defer { save_toolchain_cache(); };
+
+  auto discovery_start = begin_trace_span();
+
   auto previous_env = setup_system_sdk(arena, Target_Arch_x64);
   defer {
     /*
@@ -413,71 +712,90 @@ void load_project (Memory_Arena &arena, Project &project, Slice<Startup_Argument
                              "Failed to find any suitable toolchain on the host machine to "
                              "build & load the project's configuration file");
 
+  record_trace_span(discovery_start, "toolchain", "Toolchain discovery");
+
   auto build_file_path =
     unwrap(discover_build_file(arena, project.project_root),
            concat_string(arena, "No project configuration at: ", project.project_root, "\n"));
 
   if (!silence_logs_opt) log("Configuration file: %\n", build_file_path);
 
-  /*
-    There are two parts to loading the project:
-      - Check if there's corresponding shared object
-        - If not, proceed with building the configuraiton
-      - Check the build file's timestamp
-        - If it's out of sync -> rebuild the configuration
+  auto build_file = unwrap(open_file(build_file_path));
+  defer { close_file(build_file); };
+
+  auto configuration_key = compute_configuration_key(arena, project.toolchain, build_file);
+
+  loaded_configuration = {
+    .build_file_path = build_file_path,
+    .toolchain       = project.toolchain,
+    .key             = configuration_key,
+  };
+  auto configuration_dir = make_file_path(arena, project.project_config_build_location, format_configuration_key(arena, configuration_key));
+
+  project.project_library_path = make_file_path(arena, configuration_dir, concat_string(arena, project.name, ".", get_shared_library_extension()));
+
+  if (tracing_enabled_opt) log("Project configuration key: %\n", configuration_dir);
 
-     If the project was rebuilt, update configuration's timestamp in the tags file.
+  auto index_file_path = make_file_path(arena, project.project_config_build_location, "index");
+  auto index           = load_config_cache_index(index_file_path);
+
+  /*
+    Force rebuild of all targets if the project's configuration differs from the one that was used the last time, since
+    we don't know what kind of changes were made. That's also true for switching back to a cached configuration.
    */
+  project.rebuild_required = (index.entries_count == 0) || (index.active_key != configuration_key);
 
-  auto build_file = unwrap(open_file(build_file_path));
-  defer { close_file(build_file); };
+  index.version     = Config_Cache_Index::Version;
+  index.generation += 1;
+  index.active_key  = configuration_key;
 
-  auto tag_file_path = make_file_path(arena, project.project_config_build_location, "tag");
-  auto tag_file = unwrap(open_file(tag_file_path, Write_Access | Create_Missing));
-  defer { close_file(tag_file); };
-
-  auto build_file_timestamp =
-    unwrap(get_last_update_timestamp(build_file),
-           "Failed to retrieve configuration's file timestamp.");
-
-  if (get_file_size(tag_file).or_default(0) &&
-      /*
-        Ensure that there's a built configuration library that could be loaded, otherwise it should be built anyway.
-        We cannot fully rely on the tag's file existence and its validity.
-       */
-      check_file_exists(project.project_library_path).or_default(false)) {
-    u64 checked_timestamp = 0ull;
-    if (read_bytes_into_buffer(tag_file, (u8*) &checked_timestamp, sizeof(checked_timestamp)).is_ok()) {
-      if (build_file_timestamp == checked_timestamp) return load_project_from_library(project, args);
+  Config_Cache_Index::Record *record = nullptr;
+  for (u16 idx = 0; idx < index.entries_count; idx++) {
+    if (index.records[idx].key == configuration_key) {
+      record = index.records + idx;
+      break;
     }
   }
 
-  build_project_configuration(arena, project, build_file);
-
   /*
-    Force rebuild of all targets if the project has been updated, since we don't know what kind of changes were made.
+    Ensure that there's a built configuration library that could be loaded, otherwise it should be built anyway.
+    We cannot fully rely on the index file's existence and its validity.
    */
-  project.rebuild_required = true;
-  
-  // TODO: Perhaps it's worth to add overwrite option to the write function instead?
-  ensure(reset_file_cursor(tag_file), "Failed to reset tag's file pointer");
+  if (!record || !check_file_exists(project.project_library_path).or_default(false)) {
+    if (!record) {
+      if (index.entries_count < Config_Cache_Index::Max_Entries) {
+        record = index.records + index.entries_count++;
+      }
+      else {
+        record = index.records;
+        for (u16 idx = 1; idx < index.entries_count; idx++) {
+          if (index.records[idx].last_used < record->last_used) record = index.records + idx;
+        }
+
+        auto local = arena;
+        auto evicted_dir = make_file_path(local, project.project_config_build_location, format_configuration_key(local, record->key));
+        if (tracing_enabled_opt) log("Evicting cached project configuration: %\n", evicted_dir);
+
+        if (auto result = delete_directory(evicted_dir); result.is_error())
+          log("WARNING: Couldn't remove cached project configuration at % due to an error: %\n", evicted_dir, result.error.value);
+      }
+
+      record->key = configuration_key;
+    }
 
-  if (auto result = write_bytes_to_file(tag_file, reinterpret_cast<u8*>(&build_file_timestamp), sizeof(build_file_timestamp));
-      result.is_error()) {
-    log("WARNING: CBuild couldn't update the project's tag file due to an error: %. Full rebuild will happen on the next run.\n",
-        result.error.value);
+    ensure(create_directory(configuration_dir, Force));
 
     /*
-      If something went wrong and we couldn't update the project's tag file, try delete it so that next time CBuild is called
-      we just rebuild everything.
+      If the build fails, the index stays as is, thus the next run would retry the build.
      */
-    if (auto result = delete_file(tag_file.path); result.is_error()) {
-      log("WARNING: Something went wrong and CBuild couldn't update the tag's at % file properly. Attempt to delete it also ended up with an error: %. "
-          "If this behaviour persists please try 'cbuild clean all' and if this doesn't help, report the issue.",
-          tag_file.path, result.error.value);
-    }
+    auto config_build_start = begin_trace_span();
+    build_project_configuration(arena, project, build_file, configuration_dir);
+    record_trace_span(config_build_start, "config", "Build configuration");
   }
 
+  record->last_used = index.generation;
+
+  save_config_cache_index(index_file_path, index);
+
   return load_project_from_library(project, args);
 }
-
@@ -42,6 +42,17 @@ void cleanup_workspace (Memory_Arena &arena, const File_Path &working_directory,
  */
 void load_project (Memory_Arena &arena, Project &project, Slice<Startup_Argument> args);
 
+/*
+  Checks whether the configuration loaded by load_project would be built differently now, e.g the build file, or any
+  of its includes, has been changed since.
+ */
+bool is_project_configuration_outdated (Memory_Arena &arena);
+
+/*
+  Path to the build file of the configuration loaded by load_project.
+ */
+File_Path get_loaded_configuration_path ();
+
 /*
   Update CBuild interface files in the workspace.
  */
@@ -13,6 +13,11 @@ using Atomic_Value = typename Atomic<T>::Value_Type;
 #define fin_acquire_fence() do { asm volatile ("lfence" ::: "memory"); } while (0)
 #define fin_memory_fence() do { asm volatile ("mfence" ::: "memory"); } while (0)
 
+/*
+  Hints the CPU that this is a spin-wait loop, which lowers the cost of spinning and lets the sibling hyper-thread run.
+ */
+#define fin_cpu_relax() do { asm volatile ("pause" ::: "memory"); } while (0)
+
 template <Memory_Order order = Memory_Order::Relaxed, typename T>
 static T atomic_load (const Atomic<T> &atomic) {
   using enum Memory_Order;
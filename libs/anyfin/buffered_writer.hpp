@@ -0,0 +1,110 @@
+#pragma once
+
+#include "anyfin/base.hpp"
+#include "anyfin/arena.hpp"
+#include "anyfin/console.hpp"
+#include "anyfin/file_system.hpp"
+#include "anyfin/meta.hpp"
+#include "anyfin/result.hpp"
+#include "anyfin/strings.hpp"
+
+namespace Fin {
+
+/*
+  Accumulates output in a fixed size buffer and hands it over to the OS in large chunks, rather than
+  making a system call per line. Integers are formatted straight into the buffer, so printing large
+  tables doesn't allocate any intermediate strings.
+
+  If no file is provided, the output is written into stdout.
+ */
+struct Buffered_Writer {
+  char  *buffer;
+  usize  capacity;
+  usize  offset = 0;
+
+  File *file = nullptr;
+
+  Buffered_Writer (Memory_Arena &arena, usize _capacity, File *_file = nullptr)
+    : buffer   { reserve<char>(arena, _capacity) },
+      capacity { _capacity },
+      file     { _file }
+  {
+    fin_ensure(buffer);
+    fin_ensure(capacity >= 64);
+  }
+};
+
+static Sys_Result<void> flush (Buffered_Writer &writer) {
+  if (writer.offset == 0) return Ok();
+
+  auto chunk = String(writer.buffer, writer.offset);
+  writer.offset = 0;
+
+  if (writer.file) return write_bytes_to_file(*writer.file, chunk);
+
+  return write_to_stdout(chunk);
+}
+
+static Sys_Result<void> write (Buffered_Writer &writer, String value) {
+  if (writer.offset + value.length > writer.capacity) {
+    fin_check(flush(writer));
+
+    /*
+      Values that wouldn't fit into an empty buffer go out directly.
+     */
+    if (value.length > writer.capacity) {
+      if (writer.file) return write_bytes_to_file(*writer.file, value);
+      return write_to_stdout(value);
+    }
+  }
+
+  copy_memory(writer.buffer + writer.offset, value.value, value.length);
+  writer.offset += value.length;
+
+  return Ok();
+}
+
+static Sys_Result<void> write (Buffered_Writer &writer, char value) {
+  if (writer.offset == writer.capacity) fin_check(flush(writer));
+
+  writer.buffer[writer.offset++] = value;
+
+  return Ok();
+}
+
+template <Integral I>
+static Sys_Result<void> write (Buffered_Writer &writer, I value) {
+  // u64 max takes 20 digits, plus one for the sign.
+  if (writer.offset + 21 > writer.capacity) fin_check(flush(writer));
+
+  char digits[20];
+  usize count = 0;
+
+  /*
+    Negated in the unsigned type, negating the minimum signed value itself would overflow.
+   */
+  auto magnitude = static_cast<u64>(value);
+
+  if constexpr (Signed_Integral<I>) {
+    if (value < 0) {
+      writer.buffer[writer.offset++] = '-';
+      magnitude = 0 - magnitude;
+    }
+  }
+
+  do {
+    digits[count++] = '0' + (magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0);
+
+  while (count) writer.buffer[writer.offset++] = digits[--count];
+
+  return Ok();
+}
+
+static Sys_Result<void> write (Buffered_Writer &writer, auto &&first, auto &&second, auto &&... rest) {
+  fin_check(write(writer, first));
+  return write(writer, second, rest...);
+}
+
+}
@@ -17,7 +17,13 @@ struct Spin_Lock {
     using enum Status;
     using enum Memory_Order;
 
-    while (!atomic_compare_and_set<Acquire_Release, Acquire>(this->_lock, Available, Locked));
+    while (!atomic_compare_and_set<Acquire_Release, Acquire>(this->_lock, Available, Locked)) {
+      /*
+        Waiting on a plain load keeps the cache line shared until the lock is released, instead of taking it away from
+        the owner with every failed exchange.
+       */
+      while (atomic_load(this->_lock) == Locked) fin_cpu_relax();
+    }
   }
 
   void unlock () {
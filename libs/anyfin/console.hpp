@@ -1,6 +1,7 @@
 
 #pragma once
 
+#include "anyfin/option.hpp"
 #include "anyfin/strings.hpp"
 #include "anyfin/platform.hpp"
 
@@ -8,6 +9,12 @@ namespace Fin {
 
 static Sys_Result<void> write_to_stdout (String message);
 
+/*
+  Width in columns of the terminal that the standard output is attached to. Returns none if the output is redirected
+  into a file or a pipe.
+ */
+static Option<u32> get_stdout_terminal_width ();
+
 }
 
 #ifndef FIN_CONSOLE_HPP_IMPL
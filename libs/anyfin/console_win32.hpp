@@ -34,4 +34,11 @@ static Sys_Result<void> write_to_stdout (String message) {
   return Ok();
 }
 
+static Option<u32> get_stdout_terminal_width () {
+  CONSOLE_SCREEN_BUFFER_INFO info;
+  if (!GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info)) return opt_none;
+
+  return static_cast<u32>(info.srWindow.Right - info.srWindow.Left + 1);
+}
+
 }
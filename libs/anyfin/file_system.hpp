@@ -161,8 +161,19 @@ static Sys_Result<List<File_Path>> list_files (Memory_Arena &arena, File_Path di
 
 static Sys_Result<void> copy_file (File_Path from, File_Path to);
 
+/*
+  Creates a new name for the existing file, both names refer to the same file afterwards. Both paths must be on the
+  same volume, the new name must not exist.
+ */
+static Sys_Result<void> create_hard_link (File_Path link_path, File_Path target_path);
+
 static Sys_Result<void> copy_directory (File_Path from, File_Path to);
 
+/*
+  Moves the file or directory to the new path on the same volume, fails if something already exists at the new path.
+ */
+static Sys_Result<void> rename_resource (File_Path from, File_Path to);
+
 struct File {
   void *handle;
   File_Path path;
@@ -191,8 +202,27 @@ static Sys_Result<void> read_bytes_into_buffer (File &file, u8 *buffer, usize by
 
 static Sys_Result<Array<u8>> get_file_content (Memory_Arena &arena, File &file);
 
+/*
+  Checks whether the file exists and has exactly the given content, e.g to skip rewriting generated files that haven't
+  changed. The content is read into the copy of the arena.
+ */
+static bool has_same_content (Memory_Arena arena, File_Path path, String content) {
+  auto [open_error, file] = open_file(path);
+  if (open_error) return false;
+
+  auto [read_error, existing] = get_file_content(arena, file);
+  close_file(file);
+
+  return !read_error && String(reinterpret_cast<const char *>(existing.values), existing.count) == content;
+}
+
 static Sys_Result<void> reset_file_cursor (File &file);
 
+/*
+  Cuts the file off at the current position of the file cursor, dropping everything past it.
+ */
+static Sys_Result<void> truncate_file (File &file);
+
 static Sys_Result<u64> get_last_update_timestamp (const File &file);
 
 struct File_Mapping {
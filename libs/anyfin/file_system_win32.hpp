@@ -233,8 +233,11 @@ static Sys_Result<void> for_each_file (File_Path directory, String extension, bo
 
     WIN32_FIND_DATAA data;
 
+    /*
+      Short names aren't used, while larger fetches save calls on folders with many files, e.g object folders.
+     */
     auto search_query  = concat_string(arena, directory, "\\*");
-    auto search_handle = FindFirstFile(search_query, &data);
+    auto search_handle = FindFirstFileEx(search_query, FindExInfoBasic, &data, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
     if (search_handle == INVALID_HANDLE_VALUE) return get_system_error();
     defer { FindClose(search_handle); };
 
@@ -278,18 +281,20 @@ static Sys_Result<List<File_Path>> list_files (Memory_Arena &arena, File_Path di
     defer { FindClose(search_handle); };
 
     do {
-      auto local = arena;
-      
       const auto file_name = String(cast_bytes(data.cFileName));
       if (file_name == "." || file_name == "..") continue;
 
+      /*
+        Paths are allocated in the caller's arena, since these are either returned in the list or needed by the nested
+        traversal that allocates from the same arena.
+       */
       if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
-        if (recursive) fin_check(self(local, concat_string(local, directory, "\\", file_name)));
+        if (recursive) fin_check(self(concat_string(arena, directory, "\\", file_name)));
       }
       else {
         if (!ends_with(file_name, extension)) continue;
           
-        auto file_path = concat_string(local, directory, "\\", file_name);
+        auto file_path = concat_string(arena, directory, "\\", file_name);
         if (!file_list.contains(file_path)) list_push(file_list, file_path);
       }
     } while (FindNextFileA(search_handle, &data) != 0);
@@ -327,6 +332,18 @@ static Sys_Result<void> copy_file (File_Path from, File_Path to) {
   return Ok();
 }
 
+static Sys_Result<void> create_hard_link (File_Path link_path, File_Path target_path) {
+  if (!CreateHardLink(link_path.value, target_path.value, NULL)) return get_system_error();
+
+  return Ok();
+}
+
+static Sys_Result<void> rename_resource (File_Path from, File_Path to) {
+  if (!MoveFile(from.value, to.value)) return get_system_error();
+
+  return Ok();
+}
+
 static Sys_Result<bool> is_file (File_Path path) {
   DWORD attributes = GetFileAttributes(path.value);
   if (attributes == INVALID_FILE_ATTRIBUTES) return get_system_error();
@@ -503,6 +520,11 @@ static Sys_Result<void> reset_file_cursor (File &file) {
   return Ok();
 }
 
+static Sys_Result<void> truncate_file (File &file) {
+  if (!SetEndOfFile(file.handle)) return get_system_error();
+  return Ok();
+}
+
 static Sys_Result<u64> get_last_update_timestamp (const File &file) {
   FILETIME last_update = {};
   if (!GetFileTime(file.handle, 0, 0, &last_update)) return get_system_error();
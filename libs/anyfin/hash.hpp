@@ -0,0 +1,81 @@
+#pragma once
+
+#include "anyfin/base.hpp"
+#include "anyfin/array.hpp"
+#include "anyfin/strings.hpp"
+
+namespace Fin {
+
+// 64-bit FNV-1a: http://www.isthe.com/chongo/tech/comp/fnv/
+constexpr u64 fnv_offset_basis = 0xcbf29ce484222325ull;
+constexpr u64 fnv_prime        = 0x100000001b3ull;
+
+/*
+  Hashes are meant to be chained, i.e the result of one call could be passed as the seed of the next one, to
+  fold multiple inputs into a single value without concatenating them first.
+ */
+static inline u64 hash_bytes (const void *data, usize size, u64 seed = fnv_offset_basis) {
+  auto bytes = static_cast<const u8 *>(data);
+
+  u64 hash = seed;
+  for (usize idx = 0; idx < size; idx++) {
+    hash ^= bytes[idx];
+    hash *= fnv_prime;
+  }
+
+  return hash;
+}
+
+static inline u64 hash_string (String value, u64 seed = fnv_offset_basis) {
+  return hash_bytes(value.value, value.length, seed);
+}
+
+template <typename T>
+static inline u64 hash_value (const T &value, u64 seed = fnv_offset_basis) {
+  return hash_bytes(&value, sizeof(T), seed);
+}
+
+/*
+  Hash tables are power of two arrays of records, that are looked up by their 64-bit keys with linear probing. Zero key
+  marks an empty slot, thus hashes are turned into keys with make_table_key. Records are either keys themselves, or
+  structs with a 'key' field.
+ */
+static inline u64 make_table_key (u64 hash) {
+  return hash ? hash : 1;
+}
+
+static inline u64 get_table_key (u64 record) {
+  return record;
+}
+
+template <typename T>
+static inline u64 get_table_key (const T &record) {
+  return record.key;
+}
+
+/*
+  Returns the slot of the record with the given key, or the empty slot where such record belongs. The table must never
+  be full, otherwise the lookup of a missing key doesn't terminate.
+ */
+template <typename T>
+static usize find_table_slot (const T *records, usize count, u64 key) {
+  fin_ensure(key != 0);
+  fin_ensure(count && (count & (count - 1)) == 0);
+
+  const auto mask = count - 1;
+
+  auto idx = key & mask;
+  while (true) {
+    auto slot_key = get_table_key(records[idx]);
+    if (slot_key == key || slot_key == 0) return idx;
+
+    idx = (idx + 1) & mask;
+  }
+}
+
+template <typename T>
+static usize find_table_slot (const Array<T> &table, u64 key) {
+  return find_table_slot(table.values, table.count, key);
+}
+
+} // namespace Fin
@@ -18,10 +18,15 @@ constexpr T align_forward (const T value, const usize by) {
 }
 
 constexpr auto align_forward_to_pow_2 (const auto value) {
-  if (value == 0) return 1;
+  using Value_Type = decltype(value);
 
-  const auto lead_zero_count = __builtin_clz(value);
-  return 1 << ((sizeof(decltype(value)) * 8) - lead_zero_count);
+  if (value == 0) return Value_Type(1);
+
+  /*
+    Counting is done on 64 bits, so that the shift stays within the value's width for any integral type.
+   */
+  const auto lead_zero_count = __builtin_clzll(static_cast<unsigned long long>(value));
+  return static_cast<Value_Type>(Value_Type(1) << (64 - lead_zero_count));
 }
 
 constexpr bool is_aligned_by (const auto value, const usize by) {
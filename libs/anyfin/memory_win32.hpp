@@ -19,7 +19,15 @@ static Memory_Region reserve_virtual_memory (usize size) {
 }
 
 static void free_virtual_memory (Memory_Region &memory) {
-  VirtualFree(memory.memory, memory.size, MEM_RELEASE);
+  if (!memory.memory) return;
+
+  /*
+    Releasing requires the size to be zero, the whole reservation is released.
+   */
+  [[maybe_unused]] auto released = VirtualFree(memory.memory, 0, MEM_RELEASE);
+  fin_ensure(released);
+
+  memory = Memory_Region { nullptr, 0 };
 }
 
 }
@@ -21,6 +21,11 @@ static Sys_Result<Thread> spawn_thread (const Invocable<void, T *> auto &proc, T
 
 static Sys_Result<void> shutdown_thread (Thread &thread);
 
+/*
+  Blocks until the thread exits, releasing its handle afterwards.
+ */
+static Sys_Result<void> wait_for_thread (Thread &thread);
+
 static void thread_sleep (usize milliseconds);
 
 static u32 get_current_thread_id ();
@@ -20,6 +20,17 @@ static Sys_Result<Thread> spawn_thread (const Invocable<void> auto &proc) {
 
 static Sys_Result<void> shutdown_thread (Thread &thread);
 
+static Sys_Result<void> wait_for_thread (Thread &thread) {
+  auto handle = reinterpret_cast<HANDLE>(thread.handle);
+
+  if (WaitForSingleObject(handle, INFINITE) == WAIT_FAILED) return Error(get_system_error());
+  if (!CloseHandle(handle))                                 return Error(get_system_error());
+
+  thread.handle = nullptr;
+
+  return Ok();
+}
+
 static u32 get_current_thread_id () {
   return GetCurrentThreadId();
 }
@@ -103,13 +103,21 @@ extern "C" bool setup_project (const Arguments *args, Project *project) {
 
   auto cbuild = add_executable(project, "cbuild");
   {
+    add_source_file(cbuild, "code/archive.cpp");
+    add_source_file(cbuild, "code/build_progress.cpp");
+    add_source_file(cbuild, "code/build_report.cpp");
+    add_source_file(cbuild, "code/build_trace.cpp");
     add_source_file(cbuild, "code/builder.cpp");
     add_source_file(cbuild, "code/cbuild.cpp");
     add_source_file(cbuild, "code/cbuild_api.cpp");
+    add_source_file(cbuild, "code/daemon_win32.cpp");
     add_source_file(cbuild, "code/logger.cpp");
     add_source_file(cbuild, "code/registry.cpp");
+    add_source_file(cbuild, "code/registry_command.cpp");
     add_source_file(cbuild, "code/scanner.cpp");
     add_source_file(cbuild, "code/toolchain_win32.cpp");
+    add_source_file(cbuild, "code/unity_build.cpp");
+    add_source_file(cbuild, "code/watch_win32.cpp");
     add_source_file(cbuild, "code/workspace.cpp");
 
     add_compiler_options(cbuild, "-fno-exceptions");
@@ -133,12 +141,14 @@ extern "C" bool setup_project (const Arguments *args, Project *project) {
     link_with(tests, "kernel32.lib", "advapi32.lib", "shell32.lib", "libcmt.lib");
   }
 
-  auto rdump = add_executable(project, "rdump");
+  auto micro = add_executable(project, "micro");
   {
-    add_all_sources_from_directory(rdump, "tools/registry_dump", "cpp", false);
-    add_source_files(rdump, "code/registry.cpp", "code/logger.cpp");
-    add_compiler_options(cbuild, "-fno-exceptions");
-    link_with(rdump, "kernel32.lib", "advapi32.lib");
+    add_all_sources_from_directory(micro, "bench/micro", "cpp", false);
+    add_source_files(micro, "code/build_trace.cpp", "code/logger.cpp", "code/scanner.cpp");
+
+    add_compiler_options(micro, "-fno-exceptions");
+
+    link_with(micro, "kernel32.lib", "advapi32.lib", "shell32.lib");
   }
 
   if (config == "release") {
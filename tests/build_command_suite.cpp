@@ -55,8 +55,11 @@ static String run_command (Memory_Arena &arena, String binary_path, String extra
   return result.value.output;
 }
 
+/*
+  Tests count lines of compiled files, which are printed only in the 'lines' progress mode, since the output is piped.
+ */
 static String build_testsite (Memory_Arena &arena, String extra_arguments = {}) {
-  auto build_command    = concat_string(arena, binary_path, " build ", extra_arguments);
+  auto build_command    = concat_string(arena, binary_path, " build progress=lines ", extra_arguments);
   auto build_cmd_result = run_system_command(arena, build_command);
   require(build_cmd_result);
 
@@ -69,7 +72,7 @@ static String build_project_testsite (Memory_Arena &arena, String project_dir =
     project_override = concat_string(arena, " -p=", project_dir);
   }
 
-  auto build_command    = concat_string(arena, binary_path, project_override, " build");
+  auto build_command    = concat_string(arena, binary_path, project_override, " build progress=lines");
   auto build_cmd_result = run_system_command(arena, build_command);
   require(build_cmd_result);
 
@@ -130,7 +133,7 @@ static void build_testsite_tests (Memory_Arena &arena) {
     for (auto config: configs) {
       auto local = arena;
 
-      auto output = run_command(arena, binary_path, concat_string(arena, "build toolchain=", toolchain, " config=", config));
+      auto output = run_command(arena, binary_path, concat_string(arena, "build progress=lines toolchain=", toolchain, " config=", config));
 
       require(has_substring(output, concat_string(local, "Selected toolchain - ", toolchain)));
       require(has_substring(output, concat_string(local, "Selected configuration - ", config)));
@@ -209,7 +212,7 @@ void library2 () {
     auto output = build_testsite(arena);
 
     require_lines_count(output, "Building file",  1); // library2.cpp
-    require_lines_count(output, "Linking target", 3); // library2, dynamic2, binary1
+    require_lines_count(output, "Linking target", 2); // library2, dynamic2, which exports haven't changed
 
     validate_binary(arena, "binary1", "lib2_updated,dyn1,dyn2,bin1");
   }
@@ -240,7 +243,7 @@ void library2 () {
     auto output = build_testsite(arena);
 
     require_lines_count(output, "Building file",  3); // dynamic1, dynamic2, dynamic3
-    require_lines_count(output, "Linking target", 5); // dynamic1, dynamic2, dynamic3, binary1, binary2
+    require_lines_count(output, "Linking target", 3); // dynamic1, dynamic2, dynamic3, which exports haven't changed
 
     validate_binary(arena, "binary1", "lib2_updated,dyn1,dyn2,bin1");
     validate_binary(arena, "binary2", "lib3,dyn3,bin2");
@@ -383,6 +386,705 @@ static void build_project_tests (Memory_Arena &arena) {
   }
 }
 
+static void build_project_config_cache_tests (Memory_Arena &arena) {
+  using enum File_System_Flags;
+
+  auto build_file_path = make_file_path(arena, "project", "build.cpp");
+  auto config_folder   = make_file_path(arena, ".cbuild", "project", "config");
+
+  const auto count_cached_configurations = [&] {
+    auto local = arena;
+    auto libraries = list_files(local, config_folder, "dll", true);
+    require(libraries);
+    return libraries.value.count;
+  };
+
+  auto build_file    = open_file(build_file_path).value;
+  auto mapping       = map_file_into_memory(build_file).value;
+  auto original_text = copy_string(arena, mapping.memory, mapping.size);
+  unmap_file(mapping);
+  close_file(build_file);
+
+  auto output = build_testsite(arena);
+  require_lines_count(output, "Building file", 10);
+  require(count_cached_configurations() == 1);
+
+  /*
+    Rewriting the build file with the same content updates its timestamp, which shouldn't affect anything.
+   */
+  thread_sleep(1000);
+  {
+    auto file = open_file(build_file_path, Write_Access | Always_New).value;
+    require(write_bytes_to_file(file, original_text));
+    close_file(file);
+  }
+
+  auto output2 = build_testsite(arena);
+  require_lines_count(output2, "Building file", 0);
+  require(count_cached_configurations() == 1);
+
+  test_modify_file(arena, build_file_path);
+
+  auto output3 = build_testsite(arena);
+  require_lines_count(output3, "Building file", 10);
+  require(count_cached_configurations() == 2);
+
+  /*
+    Switching back to the original configuration reuses its cached build, though targets have to be rebuilt, since
+    they were produced by a different configuration.
+   */
+  {
+    auto file = open_file(build_file_path, Write_Access | Always_New).value;
+    require(write_bytes_to_file(file, original_text));
+    close_file(file);
+  }
+
+  auto output4 = build_testsite(arena);
+  require_lines_count(output4, "Building file", 10);
+  require(count_cached_configurations() == 2);
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+  validate_binary(arena, "binary2", "lib3,dyn3,bin2");
+}
+
+static void build_toolchain_cache_tests (Memory_Arena &arena) {
+  using enum File_System_Flags;
+
+  auto toolchain_cache_file = make_file_path(arena, ".cbuild", "__toolchain");
+  require_path_not_exists(toolchain_cache_file);
+
+  auto output = build_testsite(arena);
+  require_lines_count(output, "Building file", 10);
+  require_path_exists(toolchain_cache_file);
+
+  auto output2 = build_testsite(arena);
+  require_lines_count(output2, "Building file", 0);
+
+  /*
+    Broken cache file should be ignored, with the toolchain discovered the usual way.
+   */
+  {
+    auto file = open_file(toolchain_cache_file, Write_Access | Always_New).value;
+    require(write_bytes_to_file(file, String("garbage")));
+    close_file(file);
+  }
+
+  auto output3 = build_testsite(arena);
+  require_lines_count(output3, "Building file", 0);
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+  validate_binary(arena, "binary2", "lib3,dyn3,bin2");
+
+  auto file = open_file(toolchain_cache_file).value;
+  require(get_file_size(file).value > 7);
+  close_file(file);
+}
+
+constexpr usize background_command_memory_size = megabytes(4);
+
+/*
+  Commands that keep running until something stops them are run on their own thread, with their own memory, while the
+  test drives them. Output is available once the command exits.
+ */
+struct Background_Command {
+  Memory_Arena arena;
+  String       command;
+
+  Sys_Result<System_Command_Status> result = Error(System_Error {});
+};
+
+static void run_background_command (Background_Command *command) {
+  command->result = run_system_command(command->arena, command->command);
+}
+
+static void build_daemon_tests (Memory_Arena &arena) {
+  auto stop_command = run_system_command(arena, concat_string(arena, binary_path, " daemon stop"));
+  require(stop_command);
+  require(stop_command.value.status_code != 0);
+  require(has_substring(stop_command.value.output, "No running daemon found for the project"));
+
+  /*
+    Without a running daemon, the build should proceed in the client's process.
+   */
+  auto output = build_testsite(arena);
+  require(!has_substring(output, "Build request was sent to the daemon"));
+  require_lines_count(output, "Building file", 10);
+
+  /*
+    Daemon serves requests until it's stopped.
+   */
+  Background_Command daemon {
+    .arena   = Memory_Arena { reserve<u8>(arena, background_command_memory_size), background_command_memory_size },
+    .command = concat_string(arena, binary_path, " daemon"),
+  };
+
+  auto [thread_error, thread] = spawn_thread(run_background_command, &daemon);
+  require(!thread_error);
+
+  /*
+    Until the daemon is ready builds proceed in the client's process, where there's nothing left to build.
+   */
+  bool served = false;
+  for (int attempt = 0; attempt < 60 && !served; attempt++) {
+    auto no_changes_output = build_testsite(arena);
+    served = has_substring(no_changes_output, "Build request was sent to the daemon");
+
+    if (!served) thread_sleep(500);
+  }
+
+  require(served);
+
+  test_modify_file(arena, make_file_path(arena, "code", "library1", "library1.cpp"));
+
+  auto output2 = build_testsite(arena);
+  require(has_substring(output2, "Build request was sent to the daemon"));
+  require_lines_count(output2, "Building file", 1);
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+
+  auto stop_command2 = run_system_command(arena, concat_string(arena, binary_path, " daemon stop"));
+  require(stop_command2);
+  require(stop_command2.value.status_code == 0);
+
+  require(wait_for_thread(thread));
+  require(daemon.result);
+  require(daemon.result.value.status_code == 0);
+  require(has_substring(daemon.result.value.output, "Serving build request"));
+  require(has_substring(daemon.result.value.output, "Daemon was stopped by the client"));
+
+  /*
+    Once the daemon is gone, builds are back in the client's process.
+   */
+  auto output3 = build_testsite(arena);
+  require(!has_substring(output3, "Build request was sent to the daemon"));
+  require_lines_count(output3, "Building file", 0);
+}
+
+static u64 get_binary_timestamp (Memory_Arena &arena, String binary_name) {
+  auto path = make_file_path(arena, ".cbuild", "project", "build", "out", concat_string(arena, binary_name, ".exe"));
+
+  /*
+    Binary might be missing or held by the linker, which is the same as not being there yet.
+   */
+  auto [error, file] = open_file(path);
+  if (error) return 0;
+
+  auto timestamp = get_last_update_timestamp(file).or_default(0);
+  close_file(file);
+
+  return timestamp;
+}
+
+static void wait_for_binary_update (Memory_Arena &arena, String binary_name, u64 previous_timestamp) {
+  for (int attempt = 0; attempt < 120; attempt++) {
+    auto timestamp = get_binary_timestamp(arena, binary_name);
+    if (timestamp != 0 && timestamp != previous_timestamp) return;
+
+    thread_sleep(500);
+  }
+
+  require(false);
+}
+
+static void build_watch_tests (Memory_Arena &arena) {
+  /*
+    Watcher runs until the project's configuration changes, which is how the test stops it.
+   */
+  Background_Command watcher {
+    .arena   = Memory_Arena { reserve<u8>(arena, background_command_memory_size), background_command_memory_size },
+    .command = concat_string(arena, binary_path, " watch progress=lines"),
+  };
+
+  auto [thread_error, thread] = spawn_thread(run_background_command, &watcher);
+  require(!thread_error);
+
+  wait_for_binary_update(arena, "binary1", 0);
+
+  /*
+    Library is compiled before the binary is linked, thus the change can't be absorbed by the initial build.
+   */
+  auto initial_timestamp = get_binary_timestamp(arena, "binary1");
+  test_modify_file(arena, make_file_path(arena, "code", "library1", "library1.cpp"));
+
+  wait_for_binary_update(arena, "binary1", initial_timestamp);
+
+  test_modify_file(arena, make_file_path(arena, "project", "build.cpp"));
+
+  require(wait_for_thread(thread));
+  require(watcher.result);
+  require(watcher.result.value.status_code == 1);
+
+  auto output = watcher.result.value.output;
+  require(has_substring(output, "Watching for changes..."));
+  require(has_substring(output, "Changes detected, rebuilding the project"));
+  require(has_substring(output, "Project configuration has changed, please restart the 'watch' command to load it"));
+
+  /*
+    Initial build compiles everything, the rebuild only the changed file.
+   */
+  require_lines_count(output, "Building file", 11);
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+}
+
+static void build_trace_tests (Memory_Arena &arena) {
+  auto trace_file_path = make_file_path(arena, testspace_directory, "build_trace.json");
+  require_path_not_exists(trace_file_path);
+
+  auto output = build_testsite(arena, "trace=build_trace.json");
+  require(has_substring(output, "Build trace was written into"));
+  require_lines_count(output, "Building file", 10);
+
+  require_path_exists(trace_file_path);
+
+  auto file    = open_file(trace_file_path).value;
+  auto mapping = map_file_into_memory(file).value;
+
+  auto content = String(reinterpret_cast<const char *>(mapping.memory), mapping.size);
+  require(has_substring(content, "\"traceEvents\""));
+  require(has_substring(content, "\"cat\":\"toolchain\""));
+  require(has_substring(content, "\"cat\":\"compile\""));
+  require(has_substring(content, "\"cat\":\"link\""));
+  require(has_substring(content, "\"name\":\"library1\""));
+
+  unmap_file(mapping);
+  close_file(file);
+}
+
+static void build_report_tests (Memory_Arena &arena) {
+  auto output = build_testsite(arena, "report=3 report_json=build_report.json");
+  require(has_substring(output, "Build report:"));
+  require(has_substring(output, "Critical path:"));
+  require(has_substring(output, "Serial fraction:"));
+  require(has_substring(output, "Slowest translation units:"));
+  require(has_substring(output, "Slowest targets:"));
+  require_lines_count(output, "    3) ", 2);
+  require_lines_count(output, "    4) ", 0);
+
+  auto report_file_path = make_file_path(arena, testspace_directory, "build_report.json");
+  require_path_exists(report_file_path);
+
+  auto file    = open_file(report_file_path).value;
+  auto mapping = map_file_into_memory(file).value;
+
+  auto content = String(reinterpret_cast<const char *>(mapping.memory), mapping.size);
+  require(has_substring(content, "\"critical_path_us\""));
+  require(has_substring(content, "\"kind\": \"link\""));
+  require(has_substring(content, "\"slowest_targets\""));
+
+  unmap_file(mapping);
+  close_file(file);
+
+  auto failed = run_system_command(arena, concat_string(arena, binary_path, " build report=0"));
+  require(failed);
+  require(failed.value.status_code != 0);
+}
+
+static void build_null_toolchain_tests (Memory_Arena &arena) {
+  auto output = build_testsite(arena, "null_toolchain=0");
+  require_lines_count(output, "Building file", 10);
+  require(!has_substring(output, "finished with errors"));
+
+  /*
+    Placeholders go into their own folder, the real build's folder is left untouched.
+   */
+  require_path_exists(make_file_path(arena, ".cbuild", "project", "build", "__null_toolchain", "out", "binary1.exe"));
+  require_path_exists(make_file_path(arena, ".cbuild", "project", "build", "__null_toolchain", "out", "dynamic1.lib"));
+  require_path_not_exists(make_file_path(arena, ".cbuild", "project", "build", "out", "binary1.exe"));
+  require_path_not_exists(make_file_path(arena, ".cbuild", "project", "build", "__registry"));
+
+  auto output2 = build_testsite(arena, "null_toolchain=0");
+  require_lines_count(output2, "Building file", 0);
+
+  auto output3 = build_testsite(arena);
+  require_lines_count(output3, "Building file", 10);
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+  validate_binary(arena, "binary2", "lib3,dyn3,bin2");
+
+  auto failed = run_system_command(arena, concat_string(arena, binary_path, " build null_toolchain=fast"));
+  require(failed);
+  require(failed.value.status_code != 0);
+}
+
+static void build_progress_tests (Memory_Arena &arena) {
+  auto timings_file_path = make_file_path(arena, ".cbuild", "project", "build", "__timings");
+  require_path_not_exists(timings_file_path);
+
+  /*
+    Output is piped, thus the default mode falls back to compact lines.
+   */
+  auto output = run_command(arena, binary_path, "build");
+  require_lines_count(output, "Building file", 0);
+  require(has_substring(output, "Progress: "));
+  require(has_substring(output, "tasks in"));
+  require_path_exists(timings_file_path);
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+
+  auto output2 = run_command(arena, binary_path, "build cache=off progress=status");
+  require_lines_count(output2, "Building file", 0);
+  require(has_substring(output2, "tasks in"));
+
+  auto output3 = build_testsite(arena, "cache=off");
+  require_lines_count(output3, "Building file", 10);
+  require_lines_count(output3, "Progress: ", 0);
+
+  auto failed = run_system_command(arena, concat_string(arena, binary_path, " build progress=fancy"));
+  require(failed);
+  require(failed.value.status_code != 0);
+}
+
+static void build_unity_tests (Memory_Arena &arena) {
+  auto output = build_testsite(arena, "unity=on");
+  require_lines_count(output, "Building file", 10);
+  require(!has_substring(output, "finished with errors"));
+
+  /*
+    Units include their members by absolute paths, which the scanner must follow to track changes of the members.
+   */
+  require(!has_substring(output, "Couldn't resolve the include file"));
+
+  auto unit_path = make_file_path(arena, ".cbuild", "project", "build", "unity", "library1", "unity_0.cpp");
+  require_path_exists(unit_path);
+
+  auto unit_object_path = make_file_path(arena, ".cbuild", "project", "build", "obj", "library1", "unity_0.cpp.obj");
+  require_path_exists(unit_object_path);
+  require_path_exists(make_file_path(arena, ".cbuild", "project", "build", "unity", "binary3", "unity_0.c"));
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+  validate_binary(arena, "binary2", "lib3,dyn3,bin2");
+
+  auto output2 = build_testsite(arena, "unity=on");
+  require_lines_count(output2, "Building file", 0);
+
+  /*
+    The first change rebuilds the file's unit, the second one evicts the file, which is then compiled on its own.
+   */
+  auto library_path = make_file_path(arena, "code", "library1", "library1.cpp");
+
+  test_modify_file(arena, library_path);
+
+  auto output3 = build_testsite(arena, "unity=on");
+  require_lines_count(output3, "Building file", 1);
+  require(has_substring(output3, "unity_0.cpp"));
+
+  test_modify_file(arena, library_path);
+
+  auto output4 = build_testsite(arena, "unity=on");
+  require_lines_count(output4, "Building file", 1);
+  require(has_substring(output4, "library1.cpp"));
+  require_path_not_exists(unit_path);
+
+  /*
+    Object of the removed unit is no longer produced and is collected after the build.
+   */
+  require_path_not_exists(unit_object_path);
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+}
+
+static void build_precompiled_header_tests (Memory_Arena &arena) {
+  /*
+    Every target, except for binary3 which has only C files, gets the header.
+   */
+  auto output = build_testsite(arena, "pch=on");
+  require_lines_count(output, "Precompiling header", 9);
+  require_lines_count(output, "Building file", 10);
+  require(!has_substring(output, "finished with errors"));
+
+  require_path_exists(make_file_path(arena, ".cbuild", "project", "build", "obj", "library1", "base.hpp.pch"));
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+  validate_binary(arena, "binary2", "lib3,dyn3,bin2");
+
+  auto output2 = build_testsite(arena, "pch=on");
+  require_lines_count(output2, "Precompiling header", 0);
+  require_lines_count(output2, "Building file", 0);
+
+  test_modify_file(arena, make_file_path(arena, "code", "base.hpp"));
+
+  auto output3 = build_testsite(arena, "pch=on");
+  require_lines_count(output3, "Precompiling header", 9);
+  require_lines_count(output3, "Building file", 9);
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+}
+
+static void build_response_files_tests (Memory_Arena &arena) {
+  auto output = build_testsite(arena, "long_commands=on");
+  require_lines_count(output, "Building file", 10);
+  require(!has_substring(output, "finished with errors"));
+
+  require_path_exists(make_file_path(arena, ".cbuild", "project", "build", "obj", "library1", "library1.cpp.obj.rsp"));
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+  validate_binary(arena, "binary2", "lib3,dyn3,bin2");
+
+  auto output2 = build_testsite(arena, "long_commands=on");
+  require_lines_count(output2, "Building file", 0);
+}
+
+static String build_testsite_traced (Memory_Arena &arena, String extra_arguments) {
+  auto build_command    = concat_string(arena, binary_path, " --trace build progress=lines ", extra_arguments);
+  auto build_cmd_result = run_system_command(arena, build_command);
+  require(build_cmd_result);
+
+  return build_cmd_result.value.output;
+}
+
+static void build_builtin_archiver_tests (Memory_Arena &arena) {
+  /*
+    Libraries are written by the built-in archiver only if it reads all objects, otherwise the archiver runs instead.
+   */
+  auto output = build_testsite_traced(arena, "archiver=builtin");
+  require_lines_count(output, "Building file:", 10);
+  require_lines_count(output, "Linking target:", 10);
+  require(!has_substring(output, "finished with errors"));
+  require(!has_substring(output, "has objects the built-in archiver doesn't support"));
+
+  require_path_exists(make_file_path(arena, ".cbuild", "project", "build", "out", "library1.lib"));
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+  validate_binary(arena, "binary2", "lib3,dyn3,bin2");
+
+  auto output2 = build_testsite(arena, "archiver=builtin");
+  require_lines_count(output2, "Linking target", 0);
+
+  delete_directory(make_file_path(arena, ".cbuild"));
+
+  auto output3 = build_testsite_traced(arena, "archiver=builtin bigobj=on");
+  require(!has_substring(output3, "finished with errors"));
+  require(!has_substring(output3, "has objects the built-in archiver doesn't support"));
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+}
+
+/*
+  Libraries with more sources than fit into a single batch are archived in batches.
+ */
+static void build_archive_batches_tests (Memory_Arena &arena) {
+  using enum File_System_Flags;
+
+  const u32 generated_files_count = 70;
+
+  for (u32 idx = 0; idx < generated_files_count; idx++) {
+    auto local = arena;
+
+    auto file = open_file(make_file_path(local, "code", "library1", format_string(local, "generated_%.cpp", idx)), Write_Access | Create_Missing).value;
+    require(write_bytes_to_file(file, format_string(local, "int generated_function_% () { return %; }\n", idx, idx)));
+    close_file(file);
+  }
+
+  auto batch0_path = make_file_path(arena, ".cbuild", "project", "build", "obj", "library1", "__batch_0.lib");
+  auto batch1_path = make_file_path(arena, ".cbuild", "project", "build", "obj", "library1", "__batch_1.lib");
+
+  auto output = build_testsite(arena, "trace=build_trace.json");
+  require_lines_count(output, "Building file", 10 + generated_files_count);
+  require(!has_substring(output, "finished with errors"));
+
+  require_path_exists(batch0_path);
+  require_path_exists(batch1_path);
+  require_path_exists(concat_string(arena, batch1_path, ".members"));
+
+  /*
+    Batches are timed as tasks of their own, spans are named after the batches' timing slots.
+   */
+  {
+    auto file    = open_file(make_file_path(arena, testspace_directory, "build_trace.json")).value;
+    auto mapping = map_file_into_memory(file).value;
+
+    auto content = String(reinterpret_cast<const char *>(mapping.memory), mapping.size);
+    require(has_substring(content, "\"cat\":\"archive\""));
+    require(has_substring(content, "\"name\":\"library1 batch 1\""));
+
+    unmap_file(mapping);
+    close_file(file);
+  }
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+
+  auto output2 = build_testsite(arena);
+  require_lines_count(output2, "Building file", 0);
+  require_lines_count(output2, "Linking target", 0);
+
+  /*
+    Once the library fits into a single batch, it's archived at once, leftovers of the batches must be removed.
+   */
+  for (u32 idx = 0; idx < generated_files_count; idx++) {
+    auto local = arena;
+    require(delete_file(make_file_path(local, "code", "library1", format_string(local, "generated_%.cpp", idx))));
+  }
+
+  auto output3 = build_testsite(arena);
+  require(!has_substring(output3, "finished with errors"));
+
+  require_path_not_exists(batch0_path);
+  require_path_not_exists(batch1_path);
+  require_path_not_exists(concat_string(arena, batch0_path, ".members"));
+  require_path_not_exists(concat_string(arena, batch1_path, ".members"));
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+}
+
+static bool is_thin_archive (Memory_Arena arena, File_Path path) {
+  auto file    = open_file(path).value;
+  auto content = get_file_content(arena, file).value;
+  close_file(file);
+
+  return starts_with(String(reinterpret_cast<const char *>(content.values), content.count), "!<thin>\n");
+}
+
+/*
+  MSVC's linker doesn't read thin archives, libraries should fall back to regular ones.
+ */
+static void build_thin_archive_tests (Memory_Arena &arena) {
+  auto library_path = make_file_path(arena, ".cbuild", "project", "build", "out", "library1.lib");
+
+  String archivers [] { "tool", "builtin" };
+
+  for (auto archiver: archivers) {
+    auto output = build_testsite(arena, concat_string(arena, "thin=on archiver=", archiver));
+    require_lines_count(output, "Linking target", 10);
+    require(!has_substring(output, "finished with errors"));
+
+    require(!is_thin_archive(arena, library_path));
+
+    validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+    validate_binary(arena, "binary2", "lib3,dyn3,bin2");
+
+    delete_directory(make_file_path(arena, ".cbuild"));
+  }
+
+  /*
+    LLVM's linker reads thin archives, binaries are linked against libraries that only reference the objects.
+   */
+  const auto check_llvm_thin_archive = [&] (String archiver) {
+    auto output = build_testsite(arena, concat_string(arena, "toolchain=llvm thin=on archiver=", archiver));
+    require_lines_count(output, "Linking target", 10);
+    require(!has_substring(output, "finished with errors"));
+
+    require(is_thin_archive(arena, library_path));
+
+    validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+    validate_binary(arena, "binary2", "lib3,dyn3,bin2");
+
+    delete_directory(make_file_path(arena, ".cbuild"));
+  };
+
+  check_llvm_thin_archive("builtin");
+  check_llvm_thin_archive("tool");
+}
+
+static void build_fast_link_tests (Memory_Arena &arena) {
+  auto output = build_testsite(arena, "fast_link=on");
+  require_lines_count(output, "Linking target", 10);
+  require(!has_substring(output, "finished with errors"));
+
+  auto debug_info_path = make_file_path(arena, ".cbuild", "project", "build", "out", "binary1.pdb");
+  require_path_exists(debug_info_path);
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+  validate_binary(arena, "binary2", "lib3,dyn3,bin2");
+
+  auto output2 = build_testsite(arena, "fast_link=on");
+  require_lines_count(output2, "Linking target", 0);
+
+  /*
+    Program database is a part of the target's output, the target must be relinked without it.
+   */
+  require(delete_file(debug_info_path));
+
+  auto output3 = build_testsite(arena, "fast_link=on");
+  require_lines_count(output3, "Linking target", 1);
+  require_path_exists(debug_info_path);
+}
+
+/*
+  LLD links with a thread per idle builder, the option is visible in the traced link commands.
+ */
+static void build_lld_linker_tests (Memory_Arena &arena) {
+  auto build_command = concat_string(arena, binary_path, " --trace build progress=lines linker=lld");
+  auto build_result  = run_system_command(arena, build_command);
+  require(build_result);
+
+  auto output = build_result.value.output;
+  require_lines_count(output, "Building file:", 10);
+  require(!has_substring(output, "finished with errors"));
+
+  require(has_substring(output, "Linking target binary1 with"));
+  require(has_substring(output, "/threads:"));
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+  validate_binary(arena, "binary2", "lib3,dyn3,bin2");
+}
+
+/*
+  ThinLTO links share the cache in the build folder, LLVM's toolchain can't do LTO with MSVC's linker.
+ */
+static void build_lto_tests (Memory_Arena &arena) {
+  auto lto_cache_path = make_file_path(arena, ".cbuild", "project", "build", "lto_cache");
+
+  auto output = build_testsite(arena, "toolchain=llvm lto=thin");
+  require_lines_count(output, "Linking target", 10);
+  require(!has_substring(output, "finished with errors"));
+
+  require_path_exists(lto_cache_path);
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+  validate_binary(arena, "binary2", "lib3,dyn3,bin2");
+
+  delete_directory(make_file_path(arena, ".cbuild"));
+
+  auto rejected = run_system_command(arena, concat_string(arena, binary_path, " build toolchain=llvm lto=thin linker=msvc"));
+  require(rejected);
+  require(rejected.value.status_code != 0);
+  require(has_substring(rejected.value.output, "requires LLVM's linker"));
+}
+
+static void build_install_tests (Memory_Arena &arena) {
+  auto installed_binary_path  = make_file_path(arena, "install", "bin", "binary1.exe");
+  auto installed_library_path = make_file_path(arena, "install", "lib", "library4.lib");
+
+  auto output = build_testsite(arena, "install=on");
+  require(!has_substring(output, "finished with errors"));
+  require(has_substring(output, "Installing targets:"));
+
+  require_path_exists(installed_binary_path);
+  require_path_exists(make_file_path(arena, "install", "bin", "dynamic1.dll"));
+  require_path_exists(installed_library_path);
+
+  /*
+    Nothing was relinked, installed files are the same as the outputs.
+   */
+  auto output2 = build_testsite(arena, "install=on");
+  require_lines_count(output2, "Linking target", 0);
+  require(!has_substring(output2, "Installing targets:"));
+
+  test_modify_file(arena, make_file_path(arena, "code", "binary1", "binary1.cpp"));
+
+  auto output3 = build_testsite(arena, "install=on");
+  require(has_substring(output3, "Installing targets:"));
+  require(has_substring(output3, "Target 'binary1'"));
+  require(!has_substring(output3, "Target 'library4'"));
+
+  /*
+    Installed executable is a copy, the output could be relinked while the installed program is still in use.
+   */
+  auto installed_binary = open_file(installed_binary_path).value;
+
+  test_modify_file(arena, make_file_path(arena, "code", "binary1", "binary1.cpp"));
+
+  auto output4 = build_testsite(arena, "install=on");
+  require(!has_substring(output4, "finished with errors"));
+  require_lines_count(output4, "Linking target", 1);
+  require(has_substring(output4, "Couldn't replace installed file"));
+
+  close_file(installed_binary);
+
+  validate_binary(arena, "binary1", "lib1,lib2,dyn1,dyn2,bin1");
+}
+
 static void build_cache_tests (Memory_Arena &arena) {
   auto registry_file = make_file_path(arena, testspace_directory, ".cbuild", "project", "build", "__registry");
   require_path_not_exists(registry_file);
@@ -494,7 +1196,25 @@ static Test_Case build_command_tests [] {
   define_test_case_ex(build_changes_tests,         setup_testsite, cleanup_workspace),
   define_test_case_ex(build_errors_tests,          setup_testsite, cleanup_workspace),
   define_test_case_ex(build_project_tests,         setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_project_config_cache_tests, setup_testsite, cleanup_workspace),
   define_test_case_ex(build_cache_tests,           setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_toolchain_cache_tests, setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_daemon_tests,          setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_watch_tests,           setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_trace_tests,           setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_report_tests,          setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_null_toolchain_tests,  setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_progress_tests,        setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_unity_tests,           setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_precompiled_header_tests, setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_response_files_tests,  setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_builtin_archiver_tests, setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_archive_batches_tests, setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_thin_archive_tests,    setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_fast_link_tests,       setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_lld_linker_tests,      setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_lto_tests,             setup_testsite, cleanup_workspace),
+  define_test_case_ex(build_install_tests,         setup_testsite, cleanup_workspace),
   define_test_case_ex(build_targets_tests,         setup_testsite, cleanup_workspace),
 
   define_test_case_ex(build_with_project_overwrite_tests, setup_testsite, cleanup_workspace),
@@ -48,6 +48,11 @@ static void cleanup_build_command_tests (Memory_Arena &arena) {
 
   require(check_directory_exists(output_build_folder).value == false);
   require(check_directory_exists(output_project_folder).value);
+
+  /*
+    Removed folders go through the trash, which shouldn't outlive the cleanup.
+   */
+  require(check_directory_exists(make_file_path(arena, ".cbuild", "__trash")).value == false);
 }
 
 static void cleanup_project_command_tests (Memory_Arena &arena) {
@@ -65,6 +65,7 @@ int main (int argc, char **argv) {
   run_suite(init_command);
   run_suite(build_command);
   run_suite(clean_command);
+  run_suite(registry_command);
   run_suite(user_actions);
 
   return suite_runner.report();
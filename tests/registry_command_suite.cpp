@@ -0,0 +1,164 @@
+
+#include "test_suite.hpp"
+
+extern File_Path working_directory; // Path to the root directory where the 'verify' program has been called
+extern File_Path testspace_directory;         // Path to the workspace folder where all intermediary files and folders are created
+extern File_Path binary_path;       // Executable under test
+
+static void setup_testsite (Memory_Arena &arena) {
+  if (check_directory_exists(testspace_directory).or_default(true))
+    delete_directory(testspace_directory);
+
+  create_directory(testspace_directory);
+
+  auto testsite_path = make_file_path(arena, working_directory, "tests", "testsite");
+  copy_directory(testsite_path, testspace_directory);
+
+  set_working_directory(testspace_directory);
+}
+
+static void cleanup_workspace (Memory_Arena &) {
+  set_working_directory(working_directory);
+  delete_directory(testspace_directory);
+}
+
+static String run_command (Memory_Arena &arena, String arguments) {
+  auto command = concat_string(arena, binary_path, " ", arguments);
+  auto result  = run_system_command(arena, command);
+  require(result);
+  require(result.value.status_code == 0);
+
+  return result.value.output;
+}
+
+static System_Command_Status run_failing_command (Memory_Arena &arena, String arguments) {
+  auto command = concat_string(arena, binary_path, " ", arguments);
+  auto result  = run_system_command(arena, command);
+  require(result.is_ok());
+  require(result.value.status_code != 0);
+
+  return result.value;
+}
+
+static void require_lines_count (String output, String start_with, u32 expected_count) {
+  u32 count = 0;
+
+  split_string(output, '\n')
+    .for_each([&] (auto it) { if (starts_with(it, start_with)) count += 1; });
+
+  require(count == expected_count);
+}
+
+static void registry_stats_tests (Memory_Arena &arena) {
+  auto missing = run_failing_command(arena, "registry");
+  require(has_substring(missing.output, "Registry file not found"));
+
+  run_command(arena, "build");
+
+  auto output = run_command(arena, "registry stats");
+  require(has_substring(output, "Targets:      10"));
+  require(has_substring(output, "Files:        10"));
+  require(has_substring(output, "library1: 1 files"));
+
+  auto registry_file = make_file_path(arena, ".cbuild", "project", "build", "__registry");
+
+  auto direct_output = run_command(arena, concat_string(arena, "registry stats path=", registry_file));
+  require(has_substring(direct_output, "Targets:      10"));
+}
+
+static void registry_dump_tests (Memory_Arena &arena) {
+  run_command(arena, "build");
+
+  auto output = run_command(arena, "registry dump");
+  require(has_substring(output, "Target: binary1"));
+  require(has_substring(output, "Dependencies: "));
+
+  auto target_output = run_command(arena, "registry dump target=library1");
+  require(has_substring(target_output, "Target: library1 (1 files"));
+  require(!has_substring(target_output, "Target: binary1"));
+  require_lines_count(target_output, "  0) ID: ", 1);
+
+  auto missing = run_failing_command(arena, "registry dump target=nonexisting");
+  require(has_substring(missing.output, "Target 'nonexisting' not found in the registry"));
+}
+
+static void registry_verify_tests (Memory_Arena &arena) {
+  using enum File_System_Flags;
+
+  run_command(arena, "build");
+
+  auto output = run_command(arena, "registry verify");
+  require(has_substring(output, "No problems found"));
+
+  /*
+    Cutting the registry short, verification should catch that records point past the end of the file.
+   */
+  auto registry_file_path = make_file_path(arena, ".cbuild", "project", "build", "__registry");
+  {
+    auto file = open_file(registry_file_path, Write_Access).value;
+
+    u8 header[512] {};
+    require(read_bytes_into_buffer(file, header, sizeof(header)));
+    close_file(file);
+
+    auto truncated = open_file(registry_file_path, Always_New | Write_Access).value;
+    require(write_bytes_to_file(truncated, header, sizeof(header)));
+    close_file(truncated);
+  }
+
+  auto failed = run_failing_command(arena, "registry verify");
+  require(has_substring(failed.output, "Registry file is truncated"));
+}
+
+static void write_file (Memory_Arena &arena, File_Path path, String content) {
+  using enum File_System_Flags;
+
+  auto file = open_file(path, Write_Access | Always_New).value;
+  require(write_bytes_to_file(file, content));
+  close_file(file);
+}
+
+static void registry_compact_tests (Memory_Arena &arena) {
+  auto base_header_path     = make_file_path(arena, "code", "base.hpp");
+  auto metabase_header_path = make_file_path(arena, "code", "metabase.hpp");
+
+  write_file(arena, metabase_header_path, "\n#pragma once\n\n#define META_BASE \"meta\"\n");
+  write_file(arena, base_header_path,     "\n#pragma once\n\n#define EXPORT_SYMBOL __declspec(dllexport)\n\n#include \"metabase.hpp\"\n");
+
+  run_command(arena, "build");
+
+  /*
+    Once metabase.hpp is no longer included, its record becomes stale. Targeted builds carry over dependency
+    records of all targets, thus it remains in the registry, until compaction drops it.
+   */
+  write_file(arena, base_header_path, "\n#pragma once\n\n#define EXPORT_SYMBOL __declspec(dllexport)\n");
+
+  run_command(arena, "build targets=library1");
+
+  auto output = run_command(arena, "registry compact");
+  require(has_substring(output, "Registry compacted: 3 -> 2 dependencies"));
+
+  auto verify_output = run_command(arena, "registry verify");
+  require(has_substring(verify_output, "No problems found"));
+
+  /*
+    Compaction must keep the records from the last build, otherwise the change in base.hpp would go unnoticed.
+   */
+  auto build_output = run_command(arena, "build progress=lines");
+  require_lines_count(build_output, "Building file", 3); // dynamic1, dynamic2, dynamic3
+
+  auto rebuild_output = run_command(arena, "build progress=lines");
+  require_lines_count(rebuild_output, "Building file", 0);
+
+  auto failed = run_failing_command(arena, "registry compact path=.cbuild");
+  require(has_substring(failed.output, "doesn't support the 'path' option"));
+}
+
+static Test_Case registry_command_tests [] {
+  define_test_case_ex(registry_stats_tests,   setup_testsite, cleanup_workspace),
+  define_test_case_ex(registry_dump_tests,    setup_testsite, cleanup_workspace),
+  define_test_case_ex(registry_verify_tests,  setup_testsite, cleanup_workspace),
+  define_test_case_ex(registry_compact_tests, setup_testsite, cleanup_workspace),
+};
+
+define_test_suite(registry_command, registry_command_tests)
@@ -28,6 +28,16 @@ extern "C" bool setup_project (const Arguments *args, Project *project) {
   auto toolchain = get_argument_or_default(args, "toolchain", "msvc_x64");
   auto config    = get_argument_or_default(args, "config",    "debug");
   auto cache     = get_argument_or_default(args, "cache",     "on");
+  auto unity     = get_argument_or_default(args, "unity",     "off");
+  auto pch       = get_argument_or_default(args, "pch",       "off");
+  auto long_cmds = get_argument_or_default(args, "long_commands", "off");
+  auto archiver  = get_argument_or_default(args, "archiver",  "tool");
+  auto thin      = get_argument_or_default(args, "thin",      "off");
+  auto fast_link = get_argument_or_default(args, "fast_link", "off");
+  auto linker    = get_argument_or_default(args, "linker",    "toolchain");
+  auto lto       = get_argument_or_default(args, "lto",       "off");
+  auto install   = get_argument_or_default(args, "install",   "off");
+  auto bigobj    = get_argument_or_default(args, "bigobj",    "off");
 
   register_action(project, "test_cmd", test_command);
 
@@ -38,11 +48,25 @@ extern "C" bool setup_project (const Arguments *args, Project *project) {
 
   setup_toolchain(project, toolchain);
 
+  if      (strcmp(linker, "lld")  == 0) set_linker(project, Linker_Type_LLD);
+  else if (strcmp(linker, "msvc") == 0) set_linker(project, Linker_Type_MSVC);
+
   // auto external = register_external_project(project, args, "external", "libs/external");
   // auto ext_lib  = get_external_target(project, external, "library1");
 
   if (strcmp(cache, "off") == 0) disable_registry(project);
 
+  if (strcmp(archiver, "builtin") == 0) enable_builtin_archiver(project);
+
+  if (strcmp(long_cmds, "on") == 0) {
+    // Pushes compile commands past the length where cbuild switches to response files
+    char option[64];
+    for (int idx = 0; idx < 256; idx++) {
+      snprintf(option, sizeof(option), "-DCBUILD_LONG_COMMAND_DEFINITION_%d=1", idx);
+      add_global_compiler_option(project, option);
+    }
+  }
+
   if (strstr(toolchain, "msvc")) {
     add_global_compiler_option(project, "/nologo");  
     add_global_archiver_option(project, "/nologo");  
@@ -54,30 +78,47 @@ extern "C" bool setup_project (const Arguments *args, Project *project) {
     add_include_search_path(target, "code");
 
     if (strstr(toolchain, "llvm")) link_with(target, "libcmt.lib");
+
+    if (strcmp(unity, "on") == 0) enable_unity_build(target, 4);
+    if (strcmp(pch,   "on") == 0) set_precompiled_header(target, "code/base.hpp");
+
+    if (strcmp(fast_link, "on") == 0) set_debug_info_mode(target, Debug_Info_Mode_Fast_Link);
+
+    if      (strcmp(lto, "thin") == 0) enable_lto(target, true);
+    else if (strcmp(lto, "full") == 0) enable_lto(target, false);
+  };
+
+  auto apply_library_settings = [&] (Target *target) {
+    apply_common_settings(target);
+
+    if (strcmp(thin, "on") == 0) enable_thin_archive(target);
   };
 
   auto lib1 = add_static_library(project, "library1");
   {
-    apply_common_settings(lib1);
+    apply_library_settings(lib1);
     add_all_sources_from_directory(lib1, "code/library1", "cpp", false);
+
+    // Objects with the extended COFF header have a different layout, which the built-in archiver must read
+    if (strcmp(bigobj, "on") == 0) add_compiler_option(lib1, "/bigobj");
   }
 
   auto lib2 = add_static_library(project, "library2");
   {
-    apply_common_settings(lib2);
+    apply_library_settings(lib2);
     add_all_sources_from_directory(lib2, "code/library2", "cpp", false);
     link_with(lib2, lib1);
   }
 
   auto lib3 = add_static_library(project, "library3");
   {
-    apply_common_settings(lib3);
+    apply_library_settings(lib3);
     add_all_sources_from_directory(lib3, "code/library3", "cpp", false);
   }
 
   auto lib4 = add_static_library(project, "library4");
   {
-    apply_common_settings(lib4);
+    apply_library_settings(lib4);
     add_all_sources_from_directory(lib4, "code/library4", "cpp", false);
   }
 
@@ -123,6 +164,14 @@ extern "C" bool setup_project (const Arguments *args, Project *project) {
     //link_with(bin3, ext_lib);
   }
 
+  if (strcmp(install, "on") == 0) {
+    set_install_location(project, "install/bin", "install/lib");
+
+    install_target(lib4, nullptr);
+    install_target(dyn1, nullptr);
+    install_target(bin1, nullptr);
+  }
+
   fflush(stdout); // This is needed for tests to properly capture the stdout output
 
   return true;
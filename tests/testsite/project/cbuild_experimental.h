@@ -33,6 +33,17 @@ enum Hook_Type {
 
 typedef void (*Hook_Func) (const Project *project, const Target *target, const Arguments *args, Hook_Type type) CBUILD_NO_EXCEPT;
 
+enum Linker_Type {
+  Linker_Type_Toolchain,
+  Linker_Type_MSVC,
+  Linker_Type_LLD,
+};
+
+enum Debug_Info_Mode {
+  Debug_Info_Mode_Default,
+  Debug_Info_Mode_Fast_Link,
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -47,6 +58,14 @@ CBUILD_EXPERIMENTAL_API void install_target (Target *target, const char *install
 CBUILD_EXPERIMENTAL_API void add_global_system_include_search_path (Target *target, const char *include_path) CBUILD_NO_EXCEPT;
 CBUILD_EXPERIMENTAL_API void add_system_include_search_path (Target *target, const char *include_path) CBUILD_NO_EXCEPT;
 
+CBUILD_EXPERIMENTAL_API void enable_unity_build (Target *target, unsigned int files_per_unit) CBUILD_NO_EXCEPT;
+CBUILD_EXPERIMENTAL_API void set_precompiled_header (Target *target, const char *header) CBUILD_NO_EXCEPT;
+CBUILD_EXPERIMENTAL_API void enable_builtin_archiver (Project *project) CBUILD_NO_EXCEPT;
+CBUILD_EXPERIMENTAL_API void enable_thin_archive (Target *target) CBUILD_NO_EXCEPT;
+CBUILD_EXPERIMENTAL_API void set_linker (Project *project, Linker_Type linker) CBUILD_NO_EXCEPT;
+CBUILD_EXPERIMENTAL_API void set_debug_info_mode (Target *target, Debug_Info_Mode mode) CBUILD_NO_EXCEPT;
+CBUILD_EXPERIMENTAL_API void enable_lto (Target *target, bool thin) CBUILD_NO_EXCEPT;
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file